@@ -25,6 +25,7 @@ extern "C" {
 #  define Py_async_gens_MAXFREELIST 80
 #  define Py_async_gen_asends_MAXFREELIST 80
 #  define Py_futureiters_MAXFREELIST 255
+#  define Py_task_step_wrappers_MAXFREELIST 255
 #  define Py_object_stack_chunks_MAXFREELIST 4
 #  define Py_unicode_writers_MAXFREELIST 1
 #  define Py_bytes_writers_MAXFREELIST 1
@@ -60,6 +61,7 @@ struct _Py_freelists {
     struct _Py_freelist async_gens;
     struct _Py_freelist async_gen_asends;
     struct _Py_freelist futureiters;
+    struct _Py_freelist task_step_wrappers;
     struct _Py_freelist object_stack_chunks;
     struct _Py_freelist unicode_writers;
     struct _Py_freelist bytes_writers;
@@ -185,6 +185,8 @@ struct gc_collection_stats {
     Py_ssize_t candidates;
     // Duration of the collection in seconds:
     double duration;
+    // Time spent in the mark phase (finding unreachable objects), in seconds:
+    double mark_duration;
 };
 
 /* Running stats per generation */
@@ -199,6 +201,12 @@ struct gc_generation_stats {
     Py_ssize_t candidates;
     // Duration of the collection in seconds:
     double duration;
+    // Time spent in the mark phase (finding unreachable objects), in seconds:
+    double mark_duration;
+#ifdef Py_GIL_DISABLED
+    // Time during which the world was stopped, in seconds:
+    double pause_duration;
+#endif
 };
 
 enum _GCPhase {
@@ -235,6 +243,9 @@ struct _gc_runtime_state {
     /* Which of the old spaces is the visited space */
     int visited_space;
     int phase;
+    /* Maximum number of objects that an incremental step may mark or
+       examine, or 0 for no limit.  Set by gc.set_increment_limit(). */
+    Py_ssize_t increment_limit;
 
 #ifdef Py_GIL_DISABLED
     /* This is the number of objects that survived the last full
@@ -34,6 +34,14 @@ typedef struct _JitOptContext {
     _Py_UOpsAbstractFrame frames[MAX_ABSTRACT_FRAME_DEPTH];
     int curr_frame_depth;
 
+    // The stack space and recursion checks that the checks of later
+    // calls are merged into, and the data stack space and number of
+    // frames pushed since they ran.
+    _PyUOpInstruction *stack_space_check;
+    _PyUOpInstruction *recursion_check;
+    int pushed_space;
+    int pushed_frames;
+
     // Arena for the symbolic types.
     ty_arena t_arena;
 
@@ -112,6 +112,9 @@ const uint32_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_BINARY_OP_MULTIPLY_FLOAT] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_ADD_FLOAT] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_SUBTRACT_FLOAT] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_MULTIPLY_FLOAT_INPLACE] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG,
+    [_BINARY_OP_ADD_FLOAT_INPLACE] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG,
+    [_BINARY_OP_SUBTRACT_FLOAT_INPLACE] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG,
     [_BINARY_OP_ADD_UNICODE] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_INPLACE_ADD_UNICODE] = HAS_LOCAL_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_GUARD_BINARY_OP_EXTEND] = HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
@@ -338,6 +341,7 @@ const uint32_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_JUMP_TO_TOP] = 0,
     [_SET_IP] = 0,
     [_CHECK_STACK_SPACE_OPERAND] = HAS_DEOPT_FLAG,
+    [_CHECK_RECURSION_REMAINING_OPERAND] = HAS_DEOPT_FLAG,
     [_SAVE_RETURN_OFFSET] = HAS_ARG_FLAG,
     [_EXIT_TRACE] = HAS_ESCAPES_FLAG,
     [_DYNAMIC_EXIT] = HAS_ESCAPES_FLAG,
@@ -1091,6 +1095,33 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
             { -1, -1, -1 },
         },
     },
+    [_BINARY_OP_MULTIPLY_FLOAT_INPLACE] = {
+        .best = { 0, 1, 2, 2 },
+        .entries = {
+            { 3, 0, _BINARY_OP_MULTIPLY_FLOAT_INPLACE_r03 },
+            { 3, 1, _BINARY_OP_MULTIPLY_FLOAT_INPLACE_r13 },
+            { 3, 2, _BINARY_OP_MULTIPLY_FLOAT_INPLACE_r23 },
+            { -1, -1, -1 },
+        },
+    },
+    [_BINARY_OP_ADD_FLOAT_INPLACE] = {
+        .best = { 0, 1, 2, 2 },
+        .entries = {
+            { 3, 0, _BINARY_OP_ADD_FLOAT_INPLACE_r03 },
+            { 3, 1, _BINARY_OP_ADD_FLOAT_INPLACE_r13 },
+            { 3, 2, _BINARY_OP_ADD_FLOAT_INPLACE_r23 },
+            { -1, -1, -1 },
+        },
+    },
+    [_BINARY_OP_SUBTRACT_FLOAT_INPLACE] = {
+        .best = { 0, 1, 2, 2 },
+        .entries = {
+            { 3, 0, _BINARY_OP_SUBTRACT_FLOAT_INPLACE_r03 },
+            { 3, 1, _BINARY_OP_SUBTRACT_FLOAT_INPLACE_r13 },
+            { 3, 2, _BINARY_OP_SUBTRACT_FLOAT_INPLACE_r23 },
+            { -1, -1, -1 },
+        },
+    },
     [_BINARY_OP_ADD_UNICODE] = {
         .best = { 0, 1, 2, 2 },
         .entries = {
@@ -3125,6 +3156,15 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
             { 3, 3, _CHECK_STACK_SPACE_OPERAND_r33 },
         },
     },
+    [_CHECK_RECURSION_REMAINING_OPERAND] = {
+        .best = { 0, 1, 2, 3 },
+        .entries = {
+            { 0, 0, _CHECK_RECURSION_REMAINING_OPERAND_r00 },
+            { 1, 1, _CHECK_RECURSION_REMAINING_OPERAND_r11 },
+            { 2, 2, _CHECK_RECURSION_REMAINING_OPERAND_r22 },
+            { 3, 3, _CHECK_RECURSION_REMAINING_OPERAND_r33 },
+        },
+    },
     [_SAVE_RETURN_OFFSET] = {
         .best = { 0, 1, 2, 3 },
         .entries = {
@@ -3693,6 +3733,15 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP_SUBTRACT_FLOAT_r03] = _BINARY_OP_SUBTRACT_FLOAT,
     [_BINARY_OP_SUBTRACT_FLOAT_r13] = _BINARY_OP_SUBTRACT_FLOAT,
     [_BINARY_OP_SUBTRACT_FLOAT_r23] = _BINARY_OP_SUBTRACT_FLOAT,
+    [_BINARY_OP_MULTIPLY_FLOAT_INPLACE_r03] = _BINARY_OP_MULTIPLY_FLOAT_INPLACE,
+    [_BINARY_OP_MULTIPLY_FLOAT_INPLACE_r13] = _BINARY_OP_MULTIPLY_FLOAT_INPLACE,
+    [_BINARY_OP_MULTIPLY_FLOAT_INPLACE_r23] = _BINARY_OP_MULTIPLY_FLOAT_INPLACE,
+    [_BINARY_OP_ADD_FLOAT_INPLACE_r03] = _BINARY_OP_ADD_FLOAT_INPLACE,
+    [_BINARY_OP_ADD_FLOAT_INPLACE_r13] = _BINARY_OP_ADD_FLOAT_INPLACE,
+    [_BINARY_OP_ADD_FLOAT_INPLACE_r23] = _BINARY_OP_ADD_FLOAT_INPLACE,
+    [_BINARY_OP_SUBTRACT_FLOAT_INPLACE_r03] = _BINARY_OP_SUBTRACT_FLOAT_INPLACE,
+    [_BINARY_OP_SUBTRACT_FLOAT_INPLACE_r13] = _BINARY_OP_SUBTRACT_FLOAT_INPLACE,
+    [_BINARY_OP_SUBTRACT_FLOAT_INPLACE_r23] = _BINARY_OP_SUBTRACT_FLOAT_INPLACE,
     [_BINARY_OP_ADD_UNICODE_r03] = _BINARY_OP_ADD_UNICODE,
     [_BINARY_OP_ADD_UNICODE_r13] = _BINARY_OP_ADD_UNICODE,
     [_BINARY_OP_ADD_UNICODE_r23] = _BINARY_OP_ADD_UNICODE,
@@ -4131,6 +4180,10 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_CHECK_STACK_SPACE_OPERAND_r11] = _CHECK_STACK_SPACE_OPERAND,
     [_CHECK_STACK_SPACE_OPERAND_r22] = _CHECK_STACK_SPACE_OPERAND,
     [_CHECK_STACK_SPACE_OPERAND_r33] = _CHECK_STACK_SPACE_OPERAND,
+    [_CHECK_RECURSION_REMAINING_OPERAND_r00] = _CHECK_RECURSION_REMAINING_OPERAND,
+    [_CHECK_RECURSION_REMAINING_OPERAND_r11] = _CHECK_RECURSION_REMAINING_OPERAND,
+    [_CHECK_RECURSION_REMAINING_OPERAND_r22] = _CHECK_RECURSION_REMAINING_OPERAND,
+    [_CHECK_RECURSION_REMAINING_OPERAND_r33] = _CHECK_RECURSION_REMAINING_OPERAND,
     [_SAVE_RETURN_OFFSET_r00] = _SAVE_RETURN_OFFSET,
     [_SAVE_RETURN_OFFSET_r11] = _SAVE_RETURN_OFFSET,
     [_SAVE_RETURN_OFFSET_r22] = _SAVE_RETURN_OFFSET,
@@ -4265,6 +4318,10 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP_ADD_FLOAT_r03] = "_BINARY_OP_ADD_FLOAT_r03",
     [_BINARY_OP_ADD_FLOAT_r13] = "_BINARY_OP_ADD_FLOAT_r13",
     [_BINARY_OP_ADD_FLOAT_r23] = "_BINARY_OP_ADD_FLOAT_r23",
+    [_BINARY_OP_ADD_FLOAT_INPLACE] = "_BINARY_OP_ADD_FLOAT_INPLACE",
+    [_BINARY_OP_ADD_FLOAT_INPLACE_r03] = "_BINARY_OP_ADD_FLOAT_INPLACE_r03",
+    [_BINARY_OP_ADD_FLOAT_INPLACE_r13] = "_BINARY_OP_ADD_FLOAT_INPLACE_r13",
+    [_BINARY_OP_ADD_FLOAT_INPLACE_r23] = "_BINARY_OP_ADD_FLOAT_INPLACE_r23",
     [_BINARY_OP_ADD_INT] = "_BINARY_OP_ADD_INT",
     [_BINARY_OP_ADD_INT_r03] = "_BINARY_OP_ADD_INT_r03",
     [_BINARY_OP_ADD_INT_r13] = "_BINARY_OP_ADD_INT_r13",
@@ -4281,6 +4338,10 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP_MULTIPLY_FLOAT_r03] = "_BINARY_OP_MULTIPLY_FLOAT_r03",
     [_BINARY_OP_MULTIPLY_FLOAT_r13] = "_BINARY_OP_MULTIPLY_FLOAT_r13",
     [_BINARY_OP_MULTIPLY_FLOAT_r23] = "_BINARY_OP_MULTIPLY_FLOAT_r23",
+    [_BINARY_OP_MULTIPLY_FLOAT_INPLACE] = "_BINARY_OP_MULTIPLY_FLOAT_INPLACE",
+    [_BINARY_OP_MULTIPLY_FLOAT_INPLACE_r03] = "_BINARY_OP_MULTIPLY_FLOAT_INPLACE_r03",
+    [_BINARY_OP_MULTIPLY_FLOAT_INPLACE_r13] = "_BINARY_OP_MULTIPLY_FLOAT_INPLACE_r13",
+    [_BINARY_OP_MULTIPLY_FLOAT_INPLACE_r23] = "_BINARY_OP_MULTIPLY_FLOAT_INPLACE_r23",
     [_BINARY_OP_MULTIPLY_INT] = "_BINARY_OP_MULTIPLY_INT",
     [_BINARY_OP_MULTIPLY_INT_r03] = "_BINARY_OP_MULTIPLY_INT_r03",
     [_BINARY_OP_MULTIPLY_INT_r13] = "_BINARY_OP_MULTIPLY_INT_r13",
@@ -4310,6 +4371,10 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP_SUBTRACT_FLOAT_r03] = "_BINARY_OP_SUBTRACT_FLOAT_r03",
     [_BINARY_OP_SUBTRACT_FLOAT_r13] = "_BINARY_OP_SUBTRACT_FLOAT_r13",
     [_BINARY_OP_SUBTRACT_FLOAT_r23] = "_BINARY_OP_SUBTRACT_FLOAT_r23",
+    [_BINARY_OP_SUBTRACT_FLOAT_INPLACE] = "_BINARY_OP_SUBTRACT_FLOAT_INPLACE",
+    [_BINARY_OP_SUBTRACT_FLOAT_INPLACE_r03] = "_BINARY_OP_SUBTRACT_FLOAT_INPLACE_r03",
+    [_BINARY_OP_SUBTRACT_FLOAT_INPLACE_r13] = "_BINARY_OP_SUBTRACT_FLOAT_INPLACE_r13",
+    [_BINARY_OP_SUBTRACT_FLOAT_INPLACE_r23] = "_BINARY_OP_SUBTRACT_FLOAT_INPLACE_r23",
     [_BINARY_OP_SUBTRACT_INT] = "_BINARY_OP_SUBTRACT_INT",
     [_BINARY_OP_SUBTRACT_INT_r03] = "_BINARY_OP_SUBTRACT_INT_r03",
     [_BINARY_OP_SUBTRACT_INT_r13] = "_BINARY_OP_SUBTRACT_INT_r13",
@@ -4442,6 +4507,11 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_CHECK_RECURSION_REMAINING_r11] = "_CHECK_RECURSION_REMAINING_r11",
     [_CHECK_RECURSION_REMAINING_r22] = "_CHECK_RECURSION_REMAINING_r22",
     [_CHECK_RECURSION_REMAINING_r33] = "_CHECK_RECURSION_REMAINING_r33",
+    [_CHECK_RECURSION_REMAINING_OPERAND] = "_CHECK_RECURSION_REMAINING_OPERAND",
+    [_CHECK_RECURSION_REMAINING_OPERAND_r00] = "_CHECK_RECURSION_REMAINING_OPERAND_r00",
+    [_CHECK_RECURSION_REMAINING_OPERAND_r11] = "_CHECK_RECURSION_REMAINING_OPERAND_r11",
+    [_CHECK_RECURSION_REMAINING_OPERAND_r22] = "_CHECK_RECURSION_REMAINING_OPERAND_r22",
+    [_CHECK_RECURSION_REMAINING_OPERAND_r33] = "_CHECK_RECURSION_REMAINING_OPERAND_r33",
     [_CHECK_STACK_SPACE] = "_CHECK_STACK_SPACE",
     [_CHECK_STACK_SPACE_r00] = "_CHECK_STACK_SPACE_r00",
     [_CHECK_STACK_SPACE_OPERAND] = "_CHECK_STACK_SPACE_OPERAND",
@@ -5554,6 +5624,12 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 2;
         case _BINARY_OP_SUBTRACT_FLOAT:
             return 2;
+        case _BINARY_OP_MULTIPLY_FLOAT_INPLACE:
+            return 2;
+        case _BINARY_OP_ADD_FLOAT_INPLACE:
+            return 2;
+        case _BINARY_OP_SUBTRACT_FLOAT_INPLACE:
+            return 2;
         case _BINARY_OP_ADD_UNICODE:
             return 2;
         case _BINARY_OP_INPLACE_ADD_UNICODE:
@@ -6006,6 +6082,8 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _CHECK_STACK_SPACE_OPERAND:
             return 0;
+        case _CHECK_RECURSION_REMAINING_OPERAND:
+            return 0;
         case _SAVE_RETURN_OFFSET:
             return 0;
         case _EXIT_TRACE:
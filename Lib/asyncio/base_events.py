@@ -1289,7 +1289,10 @@ async def _sendfile_native(self, transp, file, offset, count):
     async def _sendfile_fallback(self, transp, file, offset, count):
         if offset:
             file.seek(offset)
-        blocksize = min(count, 16384) if count else 16384
+        blocksize = (
+            min(count, constants.SENDFILE_FALLBACK_READBUFFER_SIZE)
+            if count else constants.SENDFILE_FALLBACK_READBUFFER_SIZE
+        )
         buf = bytearray(blocksize)
         total_sent = 0
         proto = _SendfileFallbackProtocol(transp)
@@ -1299,6 +1302,9 @@ async def _sendfile_fallback(self, transp, file, offset, count):
                     blocksize = min(count - total_sent, blocksize)
                     if blocksize <= 0:
                         return total_sent
+                if transp.get_write_buffer_size():
+                    # The transport may still reference the previous block.
+                    buf = bytearray(blocksize)
                 view = memoryview(buf)[:blocksize]
                 read = await self.run_in_executor(None, file.readinto, view)
                 if not read:
@@ -2011,14 +2017,15 @@ def _run_once(self):
         event_list = None
 
         # Handle 'later' callbacks that are ready.
-        end_time = self.time() + self._clock_resolution
-        while self._scheduled:
-            handle = self._scheduled[0]
-            if handle._when >= end_time:
-                break
-            handle = heapq.heappop(self._scheduled)
-            handle._scheduled = False
-            self._ready.append(handle)
+        if self._scheduled:
+            end_time = self.time() + self._clock_resolution
+            while self._scheduled:
+                handle = self._scheduled[0]
+                if handle._when >= end_time:
+                    break
+                handle = heapq.heappop(self._scheduled)
+                handle._scheduled = False
+                self._ready.append(handle)
 
         # This is the only place where callbacks are actually *called*.
         # All other places just add them to ready.
@@ -2026,9 +2033,10 @@ def _run_once(self):
         # callbacks scheduled by callbacks run this time around --
         # they will be run the next time (after another I/O poll).
         # Use an idiom that is thread-safe without using locks.
-        ntodo = len(self._ready)
+        ready = self._ready
+        ntodo = len(ready)
         for i in range(ntodo):
-            handle = self._ready.popleft()
+            handle = ready.popleft()
             if handle._cancelled:
                 continue
             if self._debug:
@@ -63,6 +63,9 @@ def __init__(self, selector=None):
             selector = selectors.DefaultSelector()
         logger.debug('Using selector: %s', selector.__class__.__name__)
         self._selector = selector
+        # Set while a wakeup byte written by _write_to_self() has not been
+        # consumed by _read_from_self() yet.
+        self._self_pipe_pending = False
         self._make_self_pipe()
         self._transports = weakref.WeakValueDictionary()
 
@@ -127,16 +130,23 @@ def _process_self_data(self, data):
         pass
 
     def _read_from_self(self):
-        while True:
-            try:
-                data = self._ssock.recv(4096)
-                if not data:
+        try:
+            while True:
+                try:
+                    data = self._ssock.recv(4096)
+                    if not data:
+                        break
+                    self._process_self_data(data)
+                except InterruptedError:
+                    continue
+                except BlockingIOError:
                     break
-                self._process_self_data(data)
-            except InterruptedError:
-                continue
-            except BlockingIOError:
-                break
+        finally:
+            # Only clear the flag once the socket is drained: a
+            # _write_to_self() that skipped its send() because of the flag
+            # has already queued its callback in self._ready, so the next
+            # select() won't block.
+            self._self_pipe_pending = False
 
     def _write_to_self(self):
         # This may be called from a different thread, possibly after
@@ -148,6 +158,12 @@ def _write_to_self(self):
         if csock is None:
             return
 
+        # One pending byte is enough to wake up the loop, so don't make a
+        # send() syscall for every call_soon_threadsafe() between two loop
+        # iterations.
+        if self._self_pipe_pending:
+            return
+        self._self_pipe_pending = True
         try:
             csock.send(b'\0')
         except OSError:
@@ -1220,12 +1236,14 @@ class _SelectorDatagramTransport(_SelectorTransport, transports.DatagramTranspor
 
     _buffer_factory = collections.deque
     _header_size = 8
+    _sendmmsg_batch_size = 64
 
     def __init__(self, loop, sock, protocol, address=None,
                  waiter=None, extra=None):
         super().__init__(loop, sock, protocol, extra)
         self._address = address
         self._buffer_size = 0
+        self._has_sendmmsg = hasattr(sock, 'sendmmsg')
         self._loop.call_soon(self._protocol.connection_made, self)
         # only start reading when connection_made() has been called
         self._loop.call_soon(self._add_reader,
@@ -1238,6 +1256,23 @@ def __init__(self, loop, sock, protocol, address=None,
     def get_write_buffer_size(self):
         return self._buffer_size
 
+    def _sendmmsg_buffer(self, addr):
+        # Send the leading run of buffered datagrams that share the same
+        # destination with one sendmmsg() call.
+        batch = []
+        for data, next_addr in self._buffer:
+            if next_addr != addr or len(batch) >= self._sendmmsg_batch_size:
+                break
+            batch.append(data)
+        if self._extra['peername']:
+            return self._sock.sendmmsg(batch)
+        return self._sock.sendmmsg(batch, 0, addr)
+
+    def _pop_buffer(self, count):
+        for _ in range(count):
+            data, _ = self._buffer.popleft()
+            self._buffer_size -= len(data) + self._header_size
+
     def _read_ready(self):
         if self._conn_lost:
             return
@@ -1298,26 +1333,30 @@ def sendto(self, data, addr=None):
 
     def _sendto_ready(self):
         while self._buffer:
-            data, addr = self._buffer.popleft()
-            self._buffer_size -= len(data) + self._header_size
+            data, addr = self._buffer[0]
             try:
-                if self._extra['peername']:
-                    self._sock.send(data)
+                if len(self._buffer) > 1 and self._has_sendmmsg:
+                    sent = self._sendmmsg_buffer(addr)
                 else:
-                    self._sock.sendto(data, addr)
+                    if self._extra['peername']:
+                        self._sock.send(data)
+                    else:
+                        self._sock.sendto(data, addr)
+                    sent = 1
             except (BlockingIOError, InterruptedError):
-                self._buffer.appendleft((data, addr))  # Try again later.
-                self._buffer_size += len(data) + self._header_size
-                break
+                break  # Try again later.
             except OSError as exc:
+                self._pop_buffer(1)
                 self._protocol.error_received(exc)
                 return
             except (SystemExit, KeyboardInterrupt):
                 raise
             except BaseException as exc:
+                self._pop_buffer(1)
                 self._fatal_error(
                     exc, 'Fatal write error on datagram transport')
                 return
+            self._pop_buffer(sent)
 
         self._maybe_resume_protocol()  # May append to buffer.
         if not self._buffer:
@@ -56,17 +56,25 @@ def reschedule(self, when: float | None) -> None:
 
         self._when = when
 
-        if self._timeout_handler is not None:
-            self._timeout_handler.cancel()
-
-        if when is None:
-            self._timeout_handler = None
-        else:
+        handler = self._timeout_handler
+        if when is not None:
             loop = events.get_running_loop()
-            if when <= loop.time():
-                self._timeout_handler = loop.call_soon(self._on_timeout)
+            if when > loop.time():
+                if (isinstance(handler, events.TimerHandle) and
+                        not handler.cancelled() and handler.when() <= when):
+                    # The deadline only moved later: keep the armed timer
+                    # and let _on_timeout() re-arm it, rather than adding
+                    # a cancelled handle to the loop's timer heap.
+                    return
+                new_handler = loop.call_at(when, self._on_timeout)
             else:
-                self._timeout_handler = loop.call_at(when, self._on_timeout)
+                new_handler = loop.call_soon(self._on_timeout)
+        else:
+            new_handler = None
+
+        if handler is not None:
+            handler.cancel()
+        self._timeout_handler = new_handler
 
     def expired(self) -> bool:
         """Is timeout expired during execution?"""
@@ -124,6 +132,13 @@ async def __aexit__(
 
     def _on_timeout(self) -> None:
         assert self._state is _State.ENTERED
+        handler = self._timeout_handler
+        if (isinstance(handler, events.TimerHandle) and
+                handler.when() < self._when):
+            # The deadline was extended after the timer was armed.
+            self._timeout_handler = self._task.get_loop().call_at(
+                self._when, self._on_timeout)
+            return
         self._task.cancel()
         self._state = _State.EXPIRING
         # drop the reference early
@@ -5,6 +5,7 @@
 * namedtuple   factory function for creating tuple subclasses with named fields
 * deque        list-like container with fast appends and pops on either end
 * ChainMap     dict-like class for creating a single view of multiple mappings
+* ConcurrentDict dict-like class for mappings shared by many threads
 * Counter      dict subclass for counting hashable objects
 * OrderedDict  dict subclass that remembers the order entries were added
 * defaultdict  dict subclass that calls a factory function to supply missing values
@@ -16,6 +17,7 @@
 
 __all__ = [
     'ChainMap',
+    'ConcurrentDict',
     'Counter',
     'OrderedDict',
     'UserDict',
@@ -1170,6 +1172,151 @@ def __ror__(self, other):
         return self.__class__(m)
 
 
+################################################################################
+### ConcurrentDict
+################################################################################
+
+class _ConcurrentDictKeysView(_collections_abc.KeysView):
+
+    def __iter__(self):
+        for shard in self._mapping._shards:
+            yield from shard.copy()
+
+class _ConcurrentDictItemsView(_collections_abc.ItemsView):
+
+    def __iter__(self):
+        for shard in self._mapping._shards:
+            yield from shard.copy().items()
+
+class _ConcurrentDictValuesView(_collections_abc.ValuesView):
+
+    def __iter__(self):
+        for shard in self._mapping._shards:
+            yield from shard.copy().values()
+
+
+class ConcurrentDict(_collections_abc.MutableMapping):
+    '''Dict-like class for mappings that are updated by many threads.
+
+    The items are spread over several internal dicts by the hash of their
+    keys.  In the free-threaded build, each of those dicts has its own lock,
+    so threads updating keys in different internal dicts do not contend for
+    the same lock.  Every operation on a single key is atomic.  Operations
+    on the whole mapping, such as len() and iteration, are not atomic:
+    iterating never raises RuntimeError when the mapping is changed
+    concurrently, but may or may not reflect those changes.  Insertion
+    order is not preserved.
+
+    '''
+
+    __slots__ = ('_shards', '_shift', '__weakref__')
+
+    # Number of internal dicts; must be a power of two.
+    _nshards = 32
+
+    def __init__(self, other=(), /, **kwargs):
+        self._shards = tuple({} for _ in range(self._nshards))
+        self._shift = 65 - self._nshards.bit_length()
+        self.update(other, **kwargs)
+
+    def _shard(self, key):
+        # Multiplicative (Fibonacci) hashing: the top bits of the product
+        # depend on all the bits of the hash, so keys whose hashes only
+        # differ in their high bits, such as multiples of a power of two,
+        # are still spread over all the internal dicts.
+        h = (hash(key) * 0x9E3779B97F4A7C15) & 0xFFFFFFFFFFFFFFFF
+        return self._shards[h >> self._shift]
+
+    def __getitem__(self, key):
+        return self._shard(key)[key]
+
+    def __setitem__(self, key, value):
+        self._shard(key)[key] = value
+
+    def __delitem__(self, key):
+        del self._shard(key)[key]
+
+    def __contains__(self, key):
+        return key in self._shard(key)
+
+    def __len__(self):
+        return sum(map(len, self._shards))
+
+    def __iter__(self):
+        for shard in self._shards:
+            yield from shard.copy()
+
+    def __bool__(self):
+        return any(self._shards)
+
+    def get(self, key, default=None):
+        return self._shard(key).get(key, default)
+
+    def setdefault(self, key, default=None):
+        return self._shard(key).setdefault(key, default)
+
+    def pop(self, key, *args):
+        return self._shard(key).pop(key, *args)
+
+    def popitem(self):
+        for shard in self._shards:
+            try:
+                return shard.popitem()
+            except KeyError:
+                pass
+        raise KeyError('popitem(): dictionary is empty')
+
+    def clear(self):
+        for shard in self._shards:
+            shard.clear()
+
+    def keys(self):
+        return _ConcurrentDictKeysView(self)
+
+    def items(self):
+        return _ConcurrentDictItemsView(self)
+
+    def values(self):
+        return _ConcurrentDictValuesView(self)
+
+    @_recursive_repr()
+    def __repr__(self):
+        return f'{self.__class__.__name__}({dict(self.items())!r})'
+
+    def __reduce__(self):
+        return self.__class__, (dict(self.items()),)
+
+    def copy(self):
+        return self.__class__(self.items())
+
+    __copy__ = copy
+
+    @classmethod
+    def fromkeys(cls, iterable, value=None, /):
+        self = cls()
+        for key in iterable:
+            self[key] = value
+        return self
+
+    def __ior__(self, other):
+        self.update(other)
+        return self
+
+    def __or__(self, other):
+        if not isinstance(other, _collections_abc.Mapping):
+            return NotImplemented
+        m = self.copy()
+        m.update(other)
+        return m
+
+    def __ror__(self, other):
+        if not isinstance(other, _collections_abc.Mapping):
+            return NotImplemented
+        m = self.__class__(other)
+        m.update(self)
+        return m
+
+
 ################################################################################
 ### UserDict
 ################################################################################
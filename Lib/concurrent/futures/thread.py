@@ -6,6 +6,7 @@
 __author__ = 'Brian Quinlan (brian@sweetapp.com)'
 
 from concurrent.futures import _base
+import collections
 import itertools
 import queue
 import threading
@@ -111,7 +112,7 @@ def _worker(executor_reference, ctx, work_queue):
                 # attempt to increment idle count if queue is empty
                 executor = executor_reference()
                 if executor is not None:
-                    executor._idle_semaphore.release()
+                    executor._idle_workers.append(None)
                 del executor
                 work_item = work_queue.get(block=True)
 
@@ -188,7 +189,10 @@ def __init__(self, max_workers=None, thread_name_prefix='',
 
         self._max_workers = max_workers
         self._work_queue = queue.SimpleQueue()
-        self._idle_semaphore = threading.Semaphore(0)
+        # One token per idle worker.  deque.append() and deque.pop() are
+        # atomic, which makes this much cheaper than a threading.Semaphore on
+        # the submit and worker hot paths.
+        self._idle_workers = collections.deque()
         self._threads = set()
         self._broken = False
         self._shutdown = False
@@ -218,8 +222,14 @@ def submit(self, fn, /, *args, **kwargs):
 
     def _adjust_thread_count(self):
         # if idle threads are available, don't spin new threads
-        if self._idle_semaphore.acquire(timeout=0):
-            return
+        if self._idle_workers:
+            try:
+                self._idle_workers.pop()
+            except IndexError:
+                # another submitter claimed the last idle thread
+                pass
+            else:
+                return
 
         # When the executor gets lost, the weakref callback will wake up
         # the worker threads.
@@ -7,7 +7,7 @@
 # aliases:
 from _interpreters import (
     InterpreterError, InterpreterNotFoundError, NotShareableError,
-    is_shareable,
+    SharedBuffer, is_shareable,
 )
 from ._queues import (
     create as create_queue,
@@ -19,7 +19,7 @@
     'get_current', 'get_main', 'create', 'list_all', 'is_shareable',
     'Interpreter',
     'InterpreterError', 'InterpreterNotFoundError', 'ExecutionFailed',
-    'NotShareableError',
+    'NotShareableError', 'SharedBuffer',
     'create_queue', 'Queue', 'QueueEmpty', 'QueueFull',
 ]
 
@@ -8,7 +8,7 @@
 except ImportError:
     c_scanstring = None
 
-__all__ = ['JSONDecoder', 'JSONDecodeError']
+__all__ = ['JSONDecoder', 'JSONDecodeError', 'JSONStreamDecoder']
 
 FLAGS = re.VERBOSE | re.MULTILINE | re.DOTALL
 
@@ -362,3 +362,149 @@ def raw_decode(self, s, idx=0):
         except StopIteration as err:
             raise JSONDecodeError("Expecting value", s, err.value) from None
         return obj, end
+
+
+# Characters which may end a top-level array item, outside of and inside
+# a string.
+STRUCTURAL = re.compile(r'["\[\]{},]')
+STRINGSPECIAL = re.compile(r'["\\]')
+
+class JSONStreamDecoder(object):
+    """Incremental decoder for a JSON document holding a single array
+
+    Text is passed to :meth:`feed` in chunks of any size, and each call
+    returns the array items which were completed by that chunk.  Only the
+    text of the item being decoded is kept in memory, so arbitrarily large
+    arrays can be processed as they are read::
+
+        decoder = JSONStreamDecoder()
+        while chunk := fp.read(65536):
+            for item in decoder.feed(chunk):
+                process(item)
+        decoder.close()
+
+    Items are decoded by *decoder*, a :class:`JSONDecoder` instance, so the
+    usual hooks are honoured.  When a :class:`JSONDecodeError` is raised,
+    its ``doc`` is the text of the item being decoded rather than the whole
+    document.
+
+    """
+    _START, _ITEM, _END = range(3)
+
+    def __init__(self, decoder=None):
+        self.decoder = decoder if decoder is not None else JSONDecoder()
+        self._state = self._START
+        self._first = True
+        self._pending = []
+        self._depth = 0
+        self._in_string = False
+        self._escape = False
+
+    def feed(self, data, _w=WHITESPACE.match):
+        """Decode the str ``data`` and return a list of the array items
+        completed by it.
+
+        """
+        if not isinstance(data, str):
+            raise TypeError(f'the JSON data must be str, '
+                            f'not {data.__class__.__name__}')
+        items = []
+        pos = 0
+        while pos < len(data):
+            if self._state == self._START:
+                pos = _w(data, pos).end()
+                if pos == len(data):
+                    break
+                if data[pos] != '[':
+                    raise JSONDecodeError("Expecting '['", data, pos)
+                self._state = self._ITEM
+                pos += 1
+            elif self._state == self._ITEM:
+                end = self._find_item_end(data, pos)
+                if end < 0:
+                    self._pending.append(data[pos:])
+                    break
+                self._pending.append(data[pos:end])
+                self._end_item(data[end], items)
+                pos = end + 1
+            else:
+                pos = _w(data, pos).end()
+                if pos != len(data):
+                    raise JSONDecodeError("Extra data", data, pos)
+        return items
+
+    def close(self, _w=WHITESPACE.match):
+        """Check that the whole array was fed to the decoder."""
+        if self._state == self._END:
+            return
+        s = ''.join(self._pending)
+        idx = _w(s, 0).end()
+        if self._state == self._START or idx == len(s):
+            raise JSONDecodeError("Expecting value", s, idx)
+        # Report why the last item is incomplete if the decoder can tell.
+        obj, end = self.decoder.raw_decode(s, idx)
+        raise JSONDecodeError("Expecting ',' delimiter", s, _w(s, end).end())
+
+    def _find_item_end(self, s, pos):
+        # Return the index of the comma or bracket which ends the current
+        # item at top level, or -1 if the item continues past the end of s.
+        # Only nesting and strings are tracked here; the item itself is
+        # validated when it is decoded.
+        depth = self._depth
+        in_string = self._in_string
+        if self._escape:
+            self._escape = False
+            pos += 1
+        while True:
+            if in_string:
+                m = STRINGSPECIAL.search(s, pos)
+                if m is None:
+                    break
+                pos = m.end()
+                if m.group() == '"':
+                    in_string = False
+                elif pos == len(s):
+                    self._escape = True
+                else:
+                    pos += 1
+            else:
+                m = STRUCTURAL.search(s, pos)
+                if m is None:
+                    break
+                pos = m.end()
+                c = m.group()
+                if c == '"':
+                    in_string = True
+                elif c in '[{':
+                    depth += 1
+                elif depth:
+                    if c != ',':
+                        depth -= 1
+                else:
+                    self._depth = 0
+                    self._in_string = False
+                    return m.start()
+        self._depth = depth
+        self._in_string = in_string
+        return -1
+
+    def _end_item(self, terminator, items, _w=WHITESPACE.match):
+        s = ''.join(self._pending)
+        self._pending.clear()
+        idx = _w(s, 0).end()
+        if idx == len(s):
+            if terminator == ']' and self._first:
+                self._state = self._END
+                return
+            if terminator == ']':
+                raise JSONDecodeError(
+                    "Illegal trailing comma before end of array", s, idx)
+            raise JSONDecodeError("Expecting value", s, idx)
+        obj, end = self.decoder.raw_decode(s, idx)
+        end = _w(s, end).end()
+        if end != len(s) or terminator == '}':
+            raise JSONDecodeError("Expecting ',' delimiter", s, end)
+        items.append(obj)
+        self._first = False
+        if terminator == ']':
+            self._state = self._END
@@ -1,5 +1,6 @@
 import atexit
 import errno
+import gc
 import os
 import selectors
 import signal
@@ -43,6 +44,7 @@ def __init__(self):
         self._lock = threading.Lock()
         self._preload_modules = ['__main__']
         self._preload_on_error = 'ignore'
+        self._preload_freeze = False
 
     def _stop(self):
         # Method used by unit tests to stop the server
@@ -65,12 +67,16 @@ def _stop_unlocked(self):
         self._forkserver_address = None
         self._forkserver_authkey = None
 
-    def set_forkserver_preload(self, modules_names, *, on_error='ignore'):
+    def set_forkserver_preload(self, modules_names, *, on_error='ignore',
+                               freeze=False):
         '''Set list of module names to try to load in forkserver process.
 
         The on_error parameter controls how import failures are handled:
         "ignore" (default) silently ignores failures, "warn" emits warnings,
         and "fail" raises exceptions breaking the forkserver context.
+
+        If freeze is true, the forkserver calls gc.freeze() after preloading
+        so that the forked processes share the preloaded objects.
         '''
         if not all(type(mod) is str for mod in modules_names):
             raise TypeError('module_names must be a list of strings')
@@ -81,6 +87,7 @@ def set_forkserver_preload(self, modules_names, *, on_error='ignore'):
             )
         self._preload_modules = modules_names
         self._preload_on_error = on_error
+        self._preload_freeze = bool(freeze)
 
     def get_inherited_fds(self):
         '''Return list of fds inherited from parent process.
@@ -176,6 +183,8 @@ def ensure_running(self):
                     main_kws['sys_argv'] = data['sys_argv']
                 if self._preload_on_error != 'ignore':
                     main_kws['on_error'] = self._preload_on_error
+                if self._preload_freeze:
+                    main_kws['freeze'] = True
 
             with socket.socket(socket.AF_UNIX) as listener:
                 address = connection.arbitrary_address('AF_UNIX')
@@ -282,7 +291,7 @@ def _handle_preload(preload, main_path=None, sys_path=None, sys_argv=None,
 
 
 def main(listener_fd, alive_r, preload, main_path=None, sys_path=None,
-         *, sys_argv=None, authkey_r=None, on_error='ignore'):
+         *, sys_argv=None, authkey_r=None, on_error='ignore', freeze=False):
     """Run forkserver."""
     if authkey_r is not None:
         try:
@@ -295,6 +304,15 @@ def main(listener_fd, alive_r, preload, main_path=None, sys_path=None,
 
     _handle_preload(preload, main_path, sys_path, sys_argv, on_error)
 
+    if freeze:
+        # Move the preloaded state to the permanent generation.  The garbage
+        # collector of the forked children then never writes to these
+        # objects, so the memory pages holding them stay shared with the
+        # forkserver instead of being copied on the first collection in each
+        # child.
+        gc.collect()
+        gc.freeze()
+
     util._close_stdin()
 
     sig_r, sig_w = os.pipe()
@@ -214,6 +214,86 @@ def get(self, block=True, timeout=None):
             self.not_full.notify()
             return item
 
+    def put_many(self, items, block=True, timeout=None):
+        '''Put all items of an iterable into the queue, in order.
+
+        This is equivalent to calling put() for each item, except that the
+        lock is acquired once and waiting getters are woken up in batches.
+        The 'block' and 'timeout' arguments have the same meaning as for
+        put(), with 'timeout' limiting the whole call.  If Full or ShutDown
+        is raised, the items preceding the one that could not be put remain
+        in the queue.
+        '''
+        items = list(items)
+        with self.not_full:
+            if self.is_shutdown:
+                raise ShutDown
+            endtime = None
+            if self.maxsize > 0 and block and timeout is not None:
+                if timeout < 0:
+                    raise ValueError("'timeout' must be a non-negative number")
+                endtime = time() + timeout
+            added = 0
+            try:
+                for item in items:
+                    while 0 < self.maxsize <= self._qsize():
+                        if not block:
+                            raise Full
+                        # Let getters make room for the remaining items.
+                        self.not_empty.notify(added)
+                        added = 0
+                        if endtime is None:
+                            self.not_full.wait()
+                        else:
+                            remaining = endtime - time()
+                            if remaining <= 0.0:
+                                raise Full
+                            self.not_full.wait(remaining)
+                        if self.is_shutdown:
+                            raise ShutDown
+                    self._put(item)
+                    self.unfinished_tasks += 1
+                    added += 1
+            finally:
+                self.not_empty.notify(added)
+
+    def get_many(self, max_items, block=True, timeout=None):
+        '''Remove and return a list of up to 'max_items' items from the queue.
+
+        Wait for the first item as get() does, then also take the items that
+        are immediately available, up to 'max_items' in total.  The list is
+        never empty.  The 'block' and 'timeout' arguments, and the Empty and
+        ShutDown exceptions, have the same meaning as for get().
+        '''
+        if max_items < 1:
+            raise ValueError("'max_items' must be a positive integer")
+        with self.not_empty:
+            if self.is_shutdown and not self._qsize():
+                raise ShutDown
+            if not block:
+                if not self._qsize():
+                    raise Empty
+            elif timeout is None:
+                while not self._qsize():
+                    self.not_empty.wait()
+                    if self.is_shutdown and not self._qsize():
+                        raise ShutDown
+            elif timeout < 0:
+                raise ValueError("'timeout' must be a non-negative number")
+            else:
+                endtime = time() + timeout
+                while not self._qsize():
+                    remaining = endtime - time()
+                    if remaining <= 0.0:
+                        raise Empty
+                    self.not_empty.wait(remaining)
+                    if self.is_shutdown and not self._qsize():
+                        raise ShutDown
+            count = min(max_items, self._qsize())
+            items = [self._get() for _ in range(count)]
+            self.not_full.notify(count)
+            return items
+
     def put_nowait(self, item):
         '''Put an item into the queue without blocking.
 
@@ -352,6 +432,35 @@ def get(self, block=True, timeout=None):
             raise Empty
         return self._queue.popleft()
 
+    def put_many(self, items, block=True, timeout=None):
+        '''Put all items of an iterable on the queue, in order.
+
+        The optional 'block' and 'timeout' arguments are ignored, as this method
+        never blocks.  They are provided for compatibility with the Queue class.
+        '''
+        items = list(items)
+        if items:
+            self._queue.extend(items)
+            self._count.release(len(items))
+
+    def get_many(self, max_items, block=True, timeout=None):
+        '''Remove and return a list of up to 'max_items' items from the queue.
+
+        Wait for the first item as get() does, then also take the items that
+        are immediately available, up to 'max_items' in total.  The list is
+        never empty.
+        '''
+        if max_items < 1:
+            raise ValueError("'max_items' must be a positive integer")
+        if timeout is not None and timeout < 0:
+            raise ValueError("'timeout' must be a non-negative number")
+        if not self._count.acquire(block, timeout):
+            raise Empty
+        items = [self._queue.popleft()]
+        while len(items) < max_items and self._count.acquire(False):
+            items.append(self._queue.popleft())
+        return items
+
     def put_nowait(self, item):
         '''Put an item into the queue without blocking.
 
@@ -2297,6 +2297,44 @@ def test_sock_sendfile_fallback(self):
         self.assertEqual(self.file.tell(), len(self.DATA))
         self.assertEqual(proto.data, self.DATA)
 
+    def test_sendfile_fallback_buffering_transport(self):
+        # A transport may keep a reference to written data until it has
+        # been sent; reading the next block must not overwrite it.
+        class BufferingTransport(asyncio.transports._FlowControlMixin):
+            def __init__(self, loop):
+                self.chunks = []
+                self._protocol = None
+                super().__init__(loop=loop)
+                self.set_write_buffer_limits(high=2**30)
+
+            def write(self, data):
+                self.chunks.append(data)
+
+            def get_write_buffer_size(self):
+                return sum(map(len, self.chunks))
+
+            def get_protocol(self):
+                return self._protocol
+
+            def set_protocol(self, protocol):
+                self._protocol = protocol
+
+            def is_reading(self):
+                return False
+
+            def pause_reading(self):
+                pass
+
+            def is_closing(self):
+                return False
+
+        transport = BufferingTransport(self.loop)
+        ret = self.run_loop(
+            self.loop._sendfile_fallback(transport, self.file, 0, None))
+        self.assertEqual(ret, len(self.DATA))
+        self.assertGreater(len(transport.chunks), 1)
+        self.assertEqual(b''.join(transport.chunks), self.DATA)
+
     def test_sock_sendfile_fallback_offset_and_count(self):
         sock, proto = self.prepare()
 
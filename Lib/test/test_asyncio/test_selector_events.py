@@ -154,6 +154,15 @@ def test_write_to_self_tryagain(self):
         with test_utils.disable_logger():
             self.assertIsNone(self.loop._write_to_self())
 
+    def test_write_to_self_coalesced(self):
+        self.loop._ssock.recv.side_effect = BlockingIOError
+        self.loop._write_to_self()
+        self.loop._write_to_self()
+        self.assertEqual(self.loop._csock.send.call_count, 1)
+        self.loop._read_from_self()
+        self.loop._write_to_self()
+        self.assertEqual(self.loop._csock.send.call_count, 2)
+
     def test_write_to_self_exception(self):
         # _write_to_self() swallows OSError
         self.loop._csock.send.side_effect = RuntimeError()
@@ -1590,6 +1599,7 @@ def test_sendto_ready_no_data(self):
 
     def test_sendto_ready_tryagain(self):
         self.sock.sendto.side_effect = BlockingIOError
+        self.sock.sendmmsg.side_effect = BlockingIOError
 
         transport = self.datagram_transport()
         transport._buffer.extend([(b'data1', ()), (b'data2', ())])
@@ -1601,6 +1611,48 @@ def test_sendto_ready_tryagain(self):
             [(b'data1', ()), (b'data2', ())],
             list(transport._buffer))
 
+    @unittest.skipUnless(hasattr(socket.socket, 'sendmmsg'),
+                         'requires socket.sendmmsg()')
+    def test_sendto_ready_sendmmsg(self):
+        addr1 = ('0.0.0.0', 1)
+        addr2 = ('0.0.0.0', 2)
+        self.sock.sendmmsg.side_effect = lambda bufs, flags, addr: len(bufs)
+
+        transport = self.datagram_transport()
+        transport._buffer.extend([(b'data1', addr1), (b'data2', addr1),
+                                  (b'data3', addr2), (b'data4', addr1)])
+        transport._buffer_size = 4 * (5 + transport._header_size)
+        self.loop._add_writer(7, transport._sendto_ready)
+        transport._sendto_ready()
+
+        self.assertEqual(self.sock.sendmmsg.call_args_list, [
+            mock.call([b'data1', b'data2'], 0, addr1),
+            mock.call([b'data3'], 0, addr2),
+        ])
+        self.sock.sendto.assert_called_once_with(b'data4', addr1)
+        self.assertFalse(transport._buffer)
+        self.assertEqual(transport._buffer_size, 0)
+        self.assertFalse(self.loop.writers)
+
+    @unittest.skipUnless(hasattr(socket.socket, 'sendmmsg'),
+                         'requires socket.sendmmsg()')
+    def test_sendto_ready_sendmmsg_partial(self):
+        self.sock.sendmmsg.side_effect = [1, BlockingIOError]
+
+        transport = self.datagram_transport(address=('0.0.0.0', 1))
+        transport._buffer.extend([(b'data1', ()), (b'data2', ()),
+                                  (b'data3', ())])
+        transport._buffer_size = 3 * (5 + transport._header_size)
+        self.loop._add_writer(7, transport._sendto_ready)
+        transport._sendto_ready()
+
+        self.sock.sendmmsg.assert_called_with([b'data2', b'data3'])
+        self.assertEqual([(b'data2', ()), (b'data3', ())],
+                         list(transport._buffer))
+        self.assertEqual(transport._buffer_size,
+                         2 * (5 + transport._header_size))
+        self.loop.assert_writer(7, transport._sendto_ready)
+
     def test_sendto_ready_exception(self):
         err = self.sock.sendto.side_effect = RuntimeError()
 
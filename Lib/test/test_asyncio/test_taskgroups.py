@@ -1102,6 +1102,68 @@ async def throw_error():
         # cancellation happens here and error is more understandable
         await asyncio.sleep(0)
 
+    async def test_fan_out_mixed_completion(self):
+        class MyError(Exception):
+            pass
+
+        async def immediate(i):
+            return i
+
+        async def suspended(i):
+            await asyncio.sleep(0)
+            return i
+
+        async def failing():
+            raise MyError
+
+        async with asyncio.TaskGroup() as tg:
+            tasks = [tg.create_task(immediate(i) if i % 2 else suspended(i))
+                     for i in range(10)]
+        self.assertEqual([t.result() for t in tasks], list(range(10)))
+
+        with self.assertRaises(ExceptionGroup) as cm:
+            async with asyncio.TaskGroup() as tg:
+                tg.create_task(immediate(1))
+                tg.create_task(failing())
+                tg.create_task(suspended(2))
+        self.assertEqual(len(cm.exception.exceptions), 1)
+        self.assertIsInstance(cm.exception.exceptions[0], MyError)
+
+    async def test_eager_children_not_tracked(self):
+        async def immediate():
+            return 1
+
+        async def suspended():
+            await asyncio.sleep(0)
+            return 2
+
+        loop = asyncio.get_running_loop()
+        old_factory = loop.get_task_factory()
+        self.addCleanup(loop.set_task_factory, old_factory)
+
+        async with asyncio.TaskGroup() as tg:
+            loop.set_task_factory(asyncio.eager_task_factory)
+            # A child that finished inside create_task() is not tracked.
+            done = tg.create_task(immediate())
+            self.assertTrue(done.done())
+            self.assertNotIn(done, tg._tasks)
+            self.assertEqual(len(tg._tasks), 0)
+            # An eager child that suspended is tracked.
+            pending = tg.create_task(suspended())
+            self.assertFalse(pending.done())
+            self.assertIn(pending, tg._tasks)
+
+            loop.set_task_factory(None)
+            # A child that was not started eagerly is tracked.
+            lazy = tg.create_task(immediate())
+            self.assertFalse(lazy.done())
+            self.assertIn(lazy, tg._tasks)
+            self.assertEqual(len(tg._tasks), 2)
+        self.assertEqual(done.result(), 1)
+        self.assertEqual(pending.result(), 2)
+        self.assertEqual(lazy.result(), 1)
+        self.assertEqual(len(tg._tasks), 0)
+
 
 class TestTaskGroup(BaseTestTaskGroup, unittest.IsolatedAsyncioTestCase):
     loop_factory = asyncio.EventLoop
@@ -251,6 +251,35 @@ async def f():
             await task
         self.assertFalse(cm.expired())
 
+    async def test_reschedule_later_reuses_timer(self):
+        loop = asyncio.get_running_loop()
+        t0 = loop.time()
+        with self.assertRaises(TimeoutError):
+            async with asyncio.timeout(0.01) as cm:
+                handler = cm._timeout_handler
+                for i in range(100):
+                    cm.reschedule(cm.when() + 0.001)
+                # Extending the deadline neither cancels the armed timer
+                # nor schedules new ones.
+                self.assertIs(cm._timeout_handler, handler)
+                self.assertFalse(handler.cancelled())
+                deadline = cm.when()
+                await asyncio.sleep(10)
+        self.assertTrue(cm.expired())
+        self.assertGreaterEqual(loop.time(), deadline - 0.01)
+        self.assertLess(loop.time() - t0, 5)
+
+    async def test_reschedule_earlier(self):
+        loop = asyncio.get_running_loop()
+        t0 = loop.time()
+        with self.assertRaises(TimeoutError):
+            async with asyncio.timeout(10) as cm:
+                handler = cm._timeout_handler
+                cm.reschedule(loop.time() + 0.01)
+                self.assertTrue(handler.cancelled())
+                await asyncio.sleep(10)
+        self.assertLess(loop.time() - t0, 5)
+
     async def test_repr_active(self):
         async with asyncio.timeout(10) as cm:
             self.assertRegex(repr(cm), r"<Timeout \[active\] when=\d+\.\d*>")
@@ -770,6 +770,45 @@ def testfunc(n):
         # We'll also need to verify that propagation actually occurs.
         self.assertIn("_POP_TOP_NOP", uops)
 
+    def test_spills_and_reloads_placed_for_whole_trace(self):
+        def testfunc(n):
+            l = [0] * 10
+            for i in range(n):
+                l[i % 10] = l[(i + 1) % 10] + l[(i + 2) % 10]
+            return l
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(len(res), 10)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        spills = uops.count("_SPILL_OR_RELOAD")
+        # Choosing each uop's cached depth greedily from the previous one
+        # needed 8 spills and reloads for this loop.
+        self.assertLessEqual(spills, 6)
+        # A spill is never immediately followed by another one.
+        for a, b in zip(uops, uops[1:]):
+            self.assertFalse(a == b == "_SPILL_OR_RELOAD")
+
+    def test_float_inplace_reuses_temporaries(self):
+        def testfunc(n):
+            a = 1.5
+            b = 2.0
+            total = 0.0
+            for _ in range(n):
+                total += (a * b + a) * b - a
+            return total, a, b
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, (TIER2_THRESHOLD * 7.5, 1.5, 2.0))
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        # a * b reads two locals, so it must allocate a new float.
+        self.assertIn("_BINARY_OP_MULTIPLY_FLOAT", uops)
+        # The other operations can overwrite the intermediate results.
+        self.assertIn("_BINARY_OP_ADD_FLOAT_INPLACE", uops)
+        self.assertIn("_BINARY_OP_MULTIPLY_FLOAT_INPLACE", uops)
+        self.assertIn("_BINARY_OP_SUBTRACT_FLOAT_INPLACE", uops)
+
     def test_add_unicode_propagation(self):
         def testfunc(n):
             a = ""
@@ -1001,13 +1040,18 @@ def testfunc(n):
         self.assertEqual(uop_names.count("_PUSH_FRAME"), 2)
         self.assertEqual(uop_names.count("_RETURN_VALUE"), 2)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
-        # Each call gets its own _CHECK_STACK_SPACE_OPERAND
-        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 2)
-        # Each _CHECK_STACK_SPACE_OPERAND has the framesize of its function
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy12.__code__)), uops_and_operands)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy13.__code__)), uops_and_operands)
+        # The second call shares the check of the first one
+        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
+        # which covers the larger of the two frames
+        largest_stack = max(
+            _testinternalcapi.get_co_framesize(dummy12.__code__),
+            _testinternalcapi.get_co_framesize(dummy13.__code__),
+        )
+        self.assertIn(("_CHECK_STACK_SPACE_OPERAND", largest_stack),
+                      uops_and_operands)
+        self.assertEqual(uop_names.count("_CHECK_RECURSION_REMAINING"), 0)
+        self.assertIn(("_CHECK_RECURSION_REMAINING_OPERAND", 1),
+                      uops_and_operands)
 
     def test_combine_stack_space_checks_nested(self):
         def dummy12(x):
@@ -1031,11 +1075,16 @@ def testfunc(n):
         self.assertEqual(uop_names.count("_PUSH_FRAME"), 2)
         self.assertEqual(uop_names.count("_RETURN_VALUE"), 2)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
-        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 2)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy15.__code__)), uops_and_operands)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy12.__code__)), uops_and_operands)
+        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
+        largest_stack = (
+            _testinternalcapi.get_co_framesize(dummy15.__code__) +
+            _testinternalcapi.get_co_framesize(dummy12.__code__)
+        )
+        self.assertIn(("_CHECK_STACK_SPACE_OPERAND", largest_stack),
+                      uops_and_operands)
+        self.assertEqual(uop_names.count("_CHECK_RECURSION_REMAINING"), 0)
+        self.assertIn(("_CHECK_RECURSION_REMAINING_OPERAND", 2),
+                      uops_and_operands)
 
     def test_combine_stack_space_checks_several_calls(self):
         def dummy12(x):
@@ -1064,13 +1113,17 @@ def testfunc(n):
         self.assertEqual(uop_names.count("_PUSH_FRAME"), 4)
         self.assertEqual(uop_names.count("_RETURN_VALUE"), 4)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
-        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 4)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy12.__code__)), uops_and_operands)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy13.__code__)), uops_and_operands)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy18.__code__)), uops_and_operands)
+        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
+        largest_stack = (
+            _testinternalcapi.get_co_framesize(dummy18.__code__) +
+            max(_testinternalcapi.get_co_framesize(dummy12.__code__),
+                _testinternalcapi.get_co_framesize(dummy13.__code__))
+        )
+        self.assertIn(("_CHECK_STACK_SPACE_OPERAND", largest_stack),
+                      uops_and_operands)
+        self.assertEqual(uop_names.count("_CHECK_RECURSION_REMAINING"), 0)
+        self.assertIn(("_CHECK_RECURSION_REMAINING_OPERAND", 2),
+                      uops_and_operands)
 
     def test_combine_stack_space_checks_several_calls_different_order(self):
         # same as `several_calls` but with top-level calls reversed
@@ -1100,15 +1153,18 @@ def testfunc(n):
         self.assertEqual(uop_names.count("_PUSH_FRAME"), 4)
         self.assertEqual(uop_names.count("_RETURN_VALUE"), 4)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
-        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 4)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy12.__code__)), uops_and_operands)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy13.__code__)), uops_and_operands)
-        self.assertIn(("_CHECK_STACK_SPACE_OPERAND",
-                       _testinternalcapi.get_co_framesize(dummy18.__code__)), uops_and_operands)
+        self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
+        largest_stack = (
+            _testinternalcapi.get_co_framesize(dummy18.__code__) +
+            max(_testinternalcapi.get_co_framesize(dummy12.__code__),
+                _testinternalcapi.get_co_framesize(dummy13.__code__))
+        )
+        self.assertIn(("_CHECK_STACK_SPACE_OPERAND", largest_stack),
+                      uops_and_operands)
+        self.assertEqual(uop_names.count("_CHECK_RECURSION_REMAINING"), 0)
+        self.assertIn(("_CHECK_RECURSION_REMAINING_OPERAND", 2),
+                      uops_and_operands)
 
-    @unittest.skip("reopen when we combine multiple stack space checks into one")
     def test_combine_stack_space_complex(self):
         def dummy0(x):
             return x
@@ -11,14 +11,16 @@
 from itertools import product, chain, combinations
 import string
 import sys
-from test import support
+import threading
+from test import mapping_tests, support
+from test.support import threading_helper
 from test.support.import_helper import import_fresh_module
 import types
 import unittest
 
 from collections import namedtuple, Counter, OrderedDict, _count_elements
 from collections import UserDict, UserString, UserList
-from collections import ChainMap
+from collections import ChainMap, ConcurrentDict
 from collections import deque
 from collections.abc import Awaitable, Coroutine
 from collections.abc import AsyncIterator, AsyncIterable, AsyncGenerator
@@ -310,6 +312,120 @@ def __ror__(self, other):
         self.assertIs(type(tmp.maps[0]), dict)
 
 
+################################################################################
+### ConcurrentDict
+################################################################################
+
+class TestConcurrentDict(mapping_tests.TestHashMappingProtocol):
+    type2test = ConcurrentDict
+
+    def test_mutatingiteration(self):
+        # Changing the size during iteration is allowed.
+        d = self._empty_mapping()
+        d[1] = 1
+        for i in d:
+            d[i+1] = 1
+        self.assertGreaterEqual(len(d), 2)
+        for k in list(d):
+            for v in d.values():
+                del d[k]
+                break
+        self.assertEqual(len(d), 0)
+
+    def test_repr(self):
+        d = self._empty_mapping()
+        self.assertEqual(repr(d), 'ConcurrentDict({})')
+        d[1] = 2
+        self.assertEqual(repr(d), 'ConcurrentDict({1: 2})')
+        d = self._empty_mapping()
+        d[1] = d
+        self.assertEqual(repr(d), 'ConcurrentDict({1: ...})')
+
+    def test_basics(self):
+        d = ConcurrentDict({'a': 1}, b=2)
+        d.update([(i, i * i) for i in range(100)])
+        self.assertEqual(len(d), 102)
+        self.assertTrue(d)
+        self.assertEqual(d, {'a': 1, 'b': 2} | {i: i * i for i in range(100)})
+        self.assertEqual(set(d.keys()), {'a', 'b', *range(100)})
+        self.assertIn(('a', 1), d.items())
+        self.assertIn(4, d.values())
+        # Equal keys with different types land in the same shard.
+        d[1.0] = 'one'
+        self.assertEqual(d[1], 'one')
+        self.assertEqual(len(d), 102)
+        self.assertIsInstance(d, MutableMapping)
+        self.assertEqual(ConcurrentDict[str, int].__origin__, ConcurrentDict)
+        d.clear()
+        self.assertFalse(d)
+        with self.assertRaises(KeyError):
+            d.popitem()
+
+    def test_strided_keys_use_several_shards(self):
+        d = ConcurrentDict()
+        for stride in (32, 1024, 2**16, 2**32):
+            with self.subTest(stride=stride):
+                keys = range(0, 1000 * stride, stride)
+                shards = {id(d._shard(k)) for k in keys}
+                self.assertGreater(len(shards), d._nshards // 2)
+
+    def test_union_operators(self):
+        d = ConcurrentDict(a=1, b=2)
+        e = d | {'b': 3, 'c': 4}
+        self.assertIs(type(e), ConcurrentDict)
+        self.assertEqual(e, {'a': 1, 'b': 3, 'c': 4})
+        self.assertEqual(d, {'a': 1, 'b': 2})
+        e = {'b': 3, 'c': 4} | d
+        self.assertIs(type(e), ConcurrentDict)
+        self.assertEqual(e, {'a': 1, 'b': 2, 'c': 4})
+        e = ConcurrentDict(a=5) | d
+        self.assertIs(type(e), ConcurrentDict)
+        self.assertEqual(e, {'a': 1, 'b': 2})
+        self.assertEqual(d | {}, d)
+        e = d
+        e |= {'b': 3}
+        self.assertIs(e, d)
+        self.assertEqual(d, {'a': 1, 'b': 3})
+        d |= [('c', 4)]
+        self.assertEqual(d, {'a': 1, 'b': 3, 'c': 4})
+        with self.assertRaises(TypeError):
+            d | [('d', 5)]
+        with self.assertRaises(TypeError):
+            [('d', 5)] | d
+        with self.assertRaises(TypeError):
+            d |= None
+
+    def test_copy_and_pickle(self):
+        d = ConcurrentDict({i: str(i) for i in range(50)})
+        for dup in [d.copy(), copy.copy(d), copy.deepcopy(d)]:
+            self.assertIs(type(dup), ConcurrentDict)
+            self.assertEqual(dup, d)
+        for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+            with self.subTest(proto=proto):
+                dup = pickle.loads(pickle.dumps(d, proto))
+                self.assertIs(type(dup), ConcurrentDict)
+                self.assertEqual(dup, d)
+
+    @threading_helper.requires_working_threading()
+    def test_concurrent_updates(self):
+        d = ConcurrentDict()
+        nthreads = 8
+        def worker(n):
+            for i in range(1000):
+                d[n, i] = i
+                d.setdefault('shared', n)
+                self.assertEqual(d.get((n, i)), i)
+                list(d.items())
+                if i % 2:
+                    del d[n, i]
+        threads = [threading.Thread(target=worker, args=(n,))
+                   for n in range(nthreads)]
+        with threading_helper.start_threads(threads):
+            pass
+        self.assertEqual(len(d), nthreads * 500 + 1)
+        self.assertIn(d['shared'], range(nthreads))
+
+
 ################################################################################
 ### Named Tuples
 ################################################################################
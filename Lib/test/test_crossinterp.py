@@ -223,6 +223,8 @@ def ignore_byteswarning():
         *(o for o in BUILTIN_CONTAINERS if type(o) is memoryview),
         *(o for o in BUILTIN_CONTAINERS
           if type(o) is tuple and o not in TUPLES_WITHOUT_EQUALITY),
+        *(o for o in BUILTIN_CONTAINERS
+          if type(o) is frozenset),
     ]
     _UNSHAREABLE_CONTAINERS = [o for o in BUILTIN_CONTAINERS
                                if o not in _SHAREABLE_CONTAINERS]
@@ -1336,6 +1338,32 @@ def test_tuple(self):
             ((1, 2), (3, 4), (5, 6)),
         ])
 
+    def test_frozenset(self):
+        self.assert_roundtrip_equal([
+            frozenset(),
+            frozenset([1, 'spam', 2.0, b'eggs', None]),
+            frozenset([(1, 2), frozenset([3])]),
+        ])
+
+    def test_frozendict(self):
+        self.assert_roundtrip_equal([
+            frozendict(),
+            frozendict({1: 'a', 'b': 2.0, None: b'c', (1,): True}),
+            frozendict(a=frozendict(b=(1, frozenset([2])))),
+        ])
+
+    def test_frozen_containing_non_shareable_types(self):
+        for s in [EXCEPTION, OBJECT]:
+            for value in [
+                frozenset([0, s]),
+                frozendict({0: s}),
+                frozendict({s: 0}),
+                frozendict({0: frozenset([(s,)])}),
+            ]:
+                with self.subTest(repr(value)):
+                    with self.assertRaises(NotShareableError):
+                        self.get_xidata(value)
+
     def test_tuples_containing_non_shareable_types(self):
         non_shareables = [
             EXCEPTION,
@@ -846,15 +846,21 @@ def test_get_stats(self):
         self.assertEqual(len(stats), 3)
         for st in stats:
             self.assertIsInstance(st, dict)
-            self.assertEqual(
-                set(st),
-                {"collected", "collections", "uncollectable", "candidates", "duration"}
-            )
+            keys = {"collected", "collections", "uncollectable", "candidates",
+                    "duration", "mark_duration"}
+            if Py_GIL_DISABLED:
+                keys.add("pause_duration")
+            self.assertEqual(set(st), keys)
             self.assertGreaterEqual(st["collected"], 0)
             self.assertGreaterEqual(st["collections"], 0)
             self.assertGreaterEqual(st["uncollectable"], 0)
             self.assertGreaterEqual(st["candidates"], 0)
             self.assertGreaterEqual(st["duration"], 0)
+            self.assertGreaterEqual(st["mark_duration"], 0)
+            self.assertLessEqual(st["mark_duration"], st["duration"])
+            if Py_GIL_DISABLED:
+                self.assertGreaterEqual(st["pause_duration"], 0)
+                self.assertLessEqual(st["pause_duration"], st["duration"])
         # Check that collection counts are incremented correctly
         if gc.isenabled():
             self.addCleanup(gc.enable)
@@ -868,6 +874,10 @@ def test_get_stats(self):
         self.assertGreater(new[0]["duration"], old[0]["duration"])
         self.assertEqual(new[1]["duration"], old[1]["duration"])
         self.assertEqual(new[2]["duration"], old[2]["duration"])
+        self.assertGreater(new[0]["mark_duration"], old[0]["mark_duration"])
+        if Py_GIL_DISABLED:
+            self.assertGreater(new[0]["pause_duration"],
+                               old[0]["pause_duration"])
         for stat in ["collected", "uncollectable", "candidates"]:
             self.assertGreaterEqual(new[0][stat], old[0][stat])
             self.assertEqual(new[1][stat], old[1][stat])
@@ -1259,6 +1269,55 @@ def test_incremental_gc_handles_fast_cycle_creation(self):
         script = support.findfile("_test_gc_fast_cycles.py")
         run_test_script(script)
 
+    def test_set_increment_limit(self):
+        self.addCleanup(gc.set_increment_limit, gc.get_increment_limit())
+        self.assertEqual(gc.get_increment_limit(), 0)
+        gc.set_increment_limit(100)
+        self.assertEqual(gc.get_increment_limit(), 100)
+        gc.set_increment_limit(0)
+        self.assertEqual(gc.get_increment_limit(), 0)
+        self.assertRaises(ValueError, gc.set_increment_limit, -1)
+        self.assertRaises(TypeError, gc.set_increment_limit, 1.0)
+        # threshold2 is still ignored.
+        with gc_threshold(700, 10, 1):
+            self.assertEqual(gc.get_threshold()[2], 0)
+            self.assertEqual(gc.get_increment_limit(), 0)
+
+    @requires_gil_enabled("Free threading does not support incremental GC")
+    def test_increment_limit(self):
+        # set_increment_limit() limits the work done by each increment, but
+        # all the garbage must still be found eventually.
+        class Node:
+            pass
+
+        collected = 0
+        def callback(wr):
+            nonlocal collected
+            collected += 1
+
+        n = 2000
+        nodes = [Node() for _ in range(n)]
+        for a, b in zip(nodes, nodes[1:] + nodes[:1]):
+            a.next = b
+        refs = [weakref.ref(node, callback) for node in nodes]
+        self.addCleanup(gc.enable)
+        gc.disable()
+        self.addCleanup(gc.set_increment_limit, gc.get_increment_limit())
+        gc.set_increment_limit(50)
+        self.assertEqual(gc.get_increment_limit(), 50)
+        with gc_threshold(2000, 10):
+            gc.collect(0)
+            del nodes, a, b
+            # Each increment needs new objects to have some work to do.
+            keep = []
+            for _ in range(10_000):
+                if collected == n:
+                    break
+                keep.append([[] for _ in range(100)])
+                gc.collect(1)
+        self.assertEqual(collected, n)
+        del refs
+
 
 class GCCallbackTests(unittest.TestCase):
     def setUp(self):
@@ -1926,6 +1926,57 @@ class SubBytes(bytes):
                     interpreters.is_shareable(obj))
 
 
+class TestSharedBuffer(TestBase):
+
+    def test_buffer(self):
+        data = bytearray(b'spam' * 100)
+        buf = interpreters.SharedBuffer(data)
+        data[:4] = b'eggs'
+        self.assertEqual(len(buf), 400)
+        self.assertEqual(bytes(buf), b'spam' * 100)
+        view = memoryview(buf)
+        self.assertTrue(view.readonly)
+        self.assertEqual(view[:4], b'spam')
+        self.assertEqual(len(interpreters.SharedBuffer(b'')), 0)
+        self.assertTrue(interpreters.is_shareable(buf))
+        with self.assertRaises(TypeError):
+            interpreters.SharedBuffer('spam')
+        with self.assertRaises(TypeError):
+            interpreters.SharedBuffer(data=b'spam')
+
+    def test_send_to_interpreter(self):
+        buf = interpreters.SharedBuffer(b'spam' * 100)
+        interp = interpreters.create()
+        queue = interpreters.create_queue()
+        interp.prepare_main(queue=queue)
+        queue.put(buf)
+        interp.exec(dedent("""
+            import _interpreters
+            buf = queue.get()
+            assert isinstance(buf, _interpreters.SharedBuffer), type(buf)
+            assert bytes(buf) == b'spam' * 100
+            queue.put(buf)
+            queue.put(_interpreters.SharedBuffer(b'eggs'))
+            """))
+        self.assertEqual(bytes(queue.get()), b'spam' * 100)
+        obj = queue.get()
+        self.assertIs(type(obj), interpreters.SharedBuffer)
+        self.assertEqual(bytes(obj), b'eggs')
+        self.assertEqual(bytes(buf), b'spam' * 100)
+
+    def test_outlives_creating_interpreter(self):
+        interp = interpreters.create()
+        queue = interpreters.create_queue()
+        interp.prepare_main(queue=queue)
+        interp.exec(dedent("""
+            import _interpreters
+            queue.put(_interpreters.SharedBuffer(b'spam' * 100))
+            """))
+        buf = queue.get()
+        interp.close()
+        self.assertEqual(bytes(buf), b'spam' * 100)
+
+
 class LowLevelTests(TestBase):
 
     # The behaviors in the low-level module are important in as much
@@ -1,5 +1,5 @@
 from io import StringIO
-from test.test_json import PyTest, CTest
+from test.test_json import PyTest, CTest, pyjson
 
 from test.support import bigmemtest, _1G
 
@@ -38,6 +38,22 @@ def test_encode_truefalse(self):
                 {2: 3.0, 4.0: 5, False: 1, 6: True}, sort_keys=True),
                 '{"false": 1, "2": 3.0, "4.0": 5, "6": true}')
 
+    def test_repeated_keys(self):
+        class S(str):
+            pass
+        keys = ['a', 'a"b', 'caf\xe9', '\u2603', 'a\nb', S('s'), 1, 2.5, None]
+        obj = [{k: i for k in keys} for i in range(3)]
+        # Enough distinct keys to fill the C encoder's key memo.
+        obj += [{'k%d' % i: i for i in range(2000)}] * 2
+        # Keys already in the full memo are still written from it.
+        obj += [{k: i for k in keys} for i in range(3)]
+        for kwargs in ({}, {'ensure_ascii': False},
+                       {'separators': (',', ':')}, {'indent': 2}):
+            with self.subTest(**kwargs):
+                s = self.dumps(obj, **kwargs)
+                self.assertEqual(s, pyjson.dumps(obj, **kwargs))
+                self.assertEqual(self.dumps(obj, **kwargs), s)
+
     # Issue 16228: Crash on encoding resized list
     def test_encode_mutated(self):
         a = [object()] * 10
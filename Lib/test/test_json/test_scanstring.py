@@ -85,6 +85,27 @@ def test_scanstring(self):
             scanstring('["Bad value", truth]', 2, True),
             ('Bad value', 12))
 
+    def test_special_characters_at_any_position(self):
+        # The C implementation skips over plain characters a machine word at
+        # a time.  Check that quotes, escapes and control characters are
+        # found wherever they are.
+        scanstring = self.json.decoder.scanstring
+        for prefix in ('', '\xe9'):
+            for n in range(20):
+                plain = prefix + 'x' * n
+                self.assertEqual(scanstring(f'"{plain}"tail', 1, True),
+                                 (plain, len(plain) + 2))
+                self.assertEqual(scanstring(f'"{plain}\\n{plain}"', 1, True),
+                                 (f'{plain}\n{plain}', 2 * len(plain) + 4))
+                self.assertEqual(scanstring(f'"{plain}\x1f"', 1, False),
+                                 (f'{plain}\x1f', len(plain) + 3))
+                with self.assertRaises(self.JSONDecodeError):
+                    scanstring(f'"{plain}\x1f"', 1, True)
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    scanstring(f'"{plain}', 1, True)
+                self.assertEqual(cm.exception.msg,
+                                 'Unterminated string starting at')
+
     def test_surrogates(self):
         scanstring = self.json.decoder.scanstring
         def assertScan(given, expect):
@@ -0,0 +1,75 @@
+from decimal import Decimal
+from test.test_json import PyTest, CTest
+
+
+class TestStreamDecoder:
+    def decode_chunks(self, chunks, **kw):
+        decoder = self.json.JSONStreamDecoder(self.json.JSONDecoder(**kw))
+        items = []
+        for chunk in chunks:
+            items.extend(decoder.feed(chunk))
+        decoder.close()
+        return items
+
+    def test_all_splits(self):
+        doc = (' [1, -2.5e3 , "a,]\\"\\\\b\\u00e9", [], {}, {"k": [1, {"x": "]"}]},'
+               ' true, false, null, "\\u2603"]\n')
+        expected = self.loads(doc)
+        for i in range(len(doc) + 1):
+            for j in range(i, len(doc) + 1):
+                with self.subTest(i=i, j=j):
+                    items = self.decode_chunks([doc[:i], doc[i:j], doc[j:]])
+                    self.assertEqual(items, expected)
+
+    def test_one_char_at_a_time(self):
+        doc = self.dumps([{'id': i, 'name': 'x' * i, 'tags': ['a', 'b']}
+                          for i in range(50)])
+        self.assertEqual(self.decode_chunks(doc), self.loads(doc))
+
+    def test_items_returned_as_completed(self):
+        decoder = self.json.JSONStreamDecoder()
+        self.assertEqual(decoder.feed('[1'), [])
+        self.assertEqual(decoder.feed('0, {"a": '), [10])
+        self.assertEqual(decoder.feed('1}, "s'), [{'a': 1}])
+        self.assertEqual(decoder.feed('"]'), ['s'])
+        self.assertEqual(decoder.feed('  '), [])
+        decoder.close()
+
+    def test_empty_array(self):
+        self.assertEqual(self.decode_chunks(['[', ' ', ']']), [])
+
+    def test_decoder_hooks(self):
+        items = self.decode_chunks(['[1.5, {"a"', ': 1}]'],
+                                   parse_float=Decimal,
+                                   object_pairs_hook=list)
+        self.assertEqual(items, [Decimal('1.5'), [('a', 1)]])
+
+    def test_invalid(self):
+        for doc, msg in [
+            ('', 'Expecting value'),
+            ('{}', "Expecting '['"),
+            ('[', 'Expecting value'),
+            ('[1', "Expecting ',' delimiter"),
+            ('[1,', 'Expecting value'),
+            ('[1,]', 'Illegal trailing comma before end of array'),
+            ('[,1]', 'Expecting value'),
+            ('[1 2]', "Expecting ',' delimiter"),
+            ('[1}', "Expecting ',' delimiter"),
+            ('[{"a": 1]', "Expecting ',' delimiter"),
+            ('["abc', 'Unterminated string starting at'),
+            ('[nul]', 'Expecting value'),
+            ('[1] 2', 'Extra data'),
+        ]:
+            with self.subTest(doc=doc):
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    self.decode_chunks([doc])
+                self.assertStartsWith(cm.exception.msg, msg)
+
+    def test_bytes_rejected(self):
+        decoder = self.json.JSONStreamDecoder()
+        with self.assertRaisesRegex(TypeError, 'must be str, not bytes'):
+            decoder.feed(b'[1]')
+
+
+class TestPyStreamDecoder(TestStreamDecoder, PyTest): pass
+class TestCStreamDecoder(TestStreamDecoder, CTest): pass
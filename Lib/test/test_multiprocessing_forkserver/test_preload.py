@@ -63,6 +63,32 @@ def capture_forkserver_stderr(self):
             sys.path.remove(tmpdir)
             shutil.rmtree(tmpdir, ignore_errors=True)
 
+    @staticmethod
+    def _send_freeze_count(conn):
+        import gc
+        conn.send(gc.get_freeze_count())
+
+    def _get_child_freeze_count(self):
+        r, w = self.ctx.Pipe(duplex=False)
+        p = self.ctx.Process(target=self._send_freeze_count, args=(w,))
+        p.start()
+        w.close()
+        result = r.recv()
+        r.close()
+        p.join()
+        self.assertEqual(p.exitcode, 0)
+        return result
+
+    def test_preload_freeze(self):
+        """Test that freeze=True makes children inherit frozen objects."""
+        self.ctx.set_forkserver_preload(['json'], freeze=True)
+        self.assertGreater(self._get_child_freeze_count(), 0)
+
+    def test_preload_no_freeze_default(self):
+        """Test that the preloaded objects are not frozen by default."""
+        self.ctx.set_forkserver_preload(['json'])
+        self.assertEqual(self._get_child_freeze_count(), 0)
+
     def test_preload_on_error_ignore_default(self):
         """Test that invalid modules are silently ignored by default."""
         self.ctx.set_forkserver_preload(['nonexistent_module_xyz'])
@@ -230,6 +230,54 @@ def test_nowait(self):
         with self.assertRaises(self.queue.Empty):
             q.get_nowait()
 
+    def test_put_many_get_many(self):
+        q = self.type2test(QUEUE_SIZE)
+        q.put_many(iter([111, 333, 222]))
+        self.assertEqual(q.qsize(), 3)
+        target_order = dict(Queue = [111, 333, 222],
+                            LifoQueue = [222, 333, 111],
+                            PriorityQueue = [111, 222, 333])
+        self.assertEqual(q.get_many(10), target_order[q.__class__.__name__])
+        self.assertTrue(q.empty())
+        q.put_many([])
+        self.assertTrue(q.empty())
+
+        q.put_many(range(4))
+        self.assertEqual(len(q.get_many(3)), 3)
+        self.assertEqual(len(q.get_many(3)), 1)
+        for i in range(7):
+            q.task_done()
+        with self.assertRaises(ValueError):
+            q.task_done()
+
+        with self.assertRaises(self.queue.Empty):
+            q.get_many(3, block=False)
+        with self.assertRaises(self.queue.Empty):
+            q.get_many(3, timeout=0.01)
+        with self.assertRaises(ValueError):
+            q.get_many(0)
+        with self.assertRaises(ValueError):
+            q.get_many(1, timeout=-1)
+        with self.assertRaises(ValueError):
+            q.put_many([1], timeout=-1)
+
+    def test_put_many_full(self):
+        q = self.type2test(3)
+        with self.assertRaises(self.queue.Full):
+            q.put_many(range(5), block=False)
+        self.assertEqual(q.qsize(), 3)
+        with self.assertRaises(self.queue.Full):
+            q.put_many([5], timeout=0.01)
+        self.assertEqual(q.qsize(), 3)
+        # put_many() waits for room for each item.
+        self.do_blocking_test(q.put_many, ([5, 6],), q.get_many, (2,))
+        items = q.get_many(3)
+        self.assertEqual(len(items), 3)
+        self.assertLessEqual({5, 6}, set(items))
+        # get_many() waits for the first item only.
+        self.assertEqual(self.do_blocking_test(q.get_many, (3,),
+                                               q.put, (7,)), [7])
+
     def test_shrinking_queue(self):
         # issue 10110
         q = self.type2test(3)
@@ -955,6 +1003,53 @@ def test_negative_timeout_raises_exception(self):
         q.put(1)
         with self.assertRaises(ValueError):
             q.get(timeout=-1)
+        with self.assertRaises(ValueError):
+            q.get_many(1, timeout=-1)
+
+    def test_put_many_get_many(self):
+        q = self.q
+        q.put_many(iter([1, 2, 3]))
+        q.put_many((4,))
+        q.put_many([])
+        self.assertEqual(q.qsize(), 4)
+        self.assertEqual(q.get_many(3), [1, 2, 3])
+        self.assertEqual(q.get_many(3, block=False), [4])
+        self.assertTrue(q.empty())
+
+        # Enough items to grow the underlying buffer.
+        q.put(-1)
+        q.put_many(range(100))
+        self.assertEqual(q.get_many(1000), [-1, *range(100)])
+
+        with self.assertRaises(self.queue.Empty):
+            q.get_many(3, block=False)
+        with self.assertRaises(self.queue.Empty):
+            q.get_many(3, timeout=1e-3)
+        with self.assertRaises(ValueError):
+            q.get_many(0)
+        with self.assertRaises(TypeError):
+            q.put_many(1)
+        self.assertTrue(q.empty())
+
+    def feed_many(self, q, seq, rnd, sentinel):
+        while seq:
+            q.put_many([seq.pop() for _ in range(min(len(seq), 7))])
+        q.put(sentinel)
+
+    def consume_many(self, q, results, sentinel):
+        while True:
+            for val in q.get_many(5):
+                if val == sentinel:
+                    return
+                results.append(val)
+
+    def test_order_batched(self):
+        # Test a pair of concurrent put_many() and get_many()
+        q = self.q
+        inputs = list(range(1000))
+        results = self.run_threads(1, q, inputs,
+                                   self.feed_many, self.consume_many)
+        self.assertEqual(results, inputs)
 
     def test_order(self):
         # Test a pair of concurrent put() and get()
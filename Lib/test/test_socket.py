@@ -3215,6 +3215,59 @@ def _testRecvFromNegative(self):
         self.cli.sendto(MSG, 0, (HOST, self.port))
 
 
+@requireAttrs(socket.socket, "recvmmsg_into", "sendmmsg")
+class MultiMessageUDPTest(SocketUDPTest):
+
+    def setUp(self):
+        super().setUp()
+        self.cli = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.addCleanup(self.cli.close)
+        self.cli.bind((HOST, 0))
+        self.serv.settimeout(support.SHORT_TIMEOUT)
+
+    def testSendAndReceive(self):
+        msgs = [b'one', bytearray(b'two'), memoryview(b'three')]
+        self.assertEqual(self.cli.sendmmsg(msgs, 0, (HOST, self.port)), 3)
+        bufs = [bytearray(8) for _ in range(5)]
+        result = self.serv.recvmmsg_into(bufs)
+        cliaddr = self.cli.getsockname()
+        self.assertEqual(result, [(3, 0, cliaddr), (3, 0, cliaddr),
+                                  (5, 0, cliaddr)])
+        self.assertEqual(bufs[:3], [b'one\0\0\0\0\0', b'two\0\0\0\0\0',
+                                    b'three\0\0\0'])
+
+    def testConnected(self):
+        self.cli.connect((HOST, self.port))
+        self.assertEqual(self.cli.sendmmsg([MSG, MSG]), 2)
+        bufs = [bytearray(len(MSG)), bytearray(len(MSG))]
+        self.assertEqual([n for n, flags, addr in
+                          self.serv.recvmmsg_into(bufs)], [len(MSG)] * 2)
+        self.assertEqual(bufs, [MSG, MSG])
+
+    def testTruncated(self):
+        self.cli.sendto(MSG, (HOST, self.port))
+        buf = bytearray(4)
+        [(nbytes, flags, addr)] = self.serv.recvmmsg_into([buf])
+        self.assertEqual(nbytes, 4)
+        self.assertTrue(flags & socket.MSG_TRUNC)
+        self.assertEqual(buf, MSG[:4])
+
+    def testNonBlocking(self):
+        self.serv.setblocking(False)
+        self.assertRaises(BlockingIOError, self.serv.recvmmsg_into,
+                          [bytearray(10)])
+
+    def testEmpty(self):
+        self.assertEqual(self.serv.recvmmsg_into([]), [])
+        self.assertEqual(self.cli.sendmmsg([], 0, (HOST, self.port)), 0)
+
+    def testBadArguments(self):
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, [b'abc'])
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, 42)
+        self.assertRaises(TypeError, self.cli.sendmmsg, ['abc'])
+        self.assertRaises(TypeError, self.cli.sendmmsg, 42)
+
+
 @unittest.skipUnless(HAVE_SOCKET_UDPLITE,
           'UDPLITE sockets required for this test.')
 class BasicUDPLITETest(ThreadedUDPLITESocketTest):
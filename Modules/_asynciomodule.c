@@ -2089,8 +2089,12 @@ TaskStepMethWrapper_dealloc(PyObject *op)
     PyTypeObject *tp = Py_TYPE(o);
     PyObject_GC_UnTrack(o);
     (void)TaskStepMethWrapper_clear(op);
-    Py_TYPE(o)->tp_free(o);
-    Py_DECREF(tp);
+
+    if (!_Py_FREELIST_PUSH(task_step_wrappers, o,
+                           Py_task_step_wrappers_MAXFREELIST)) {
+        tp->tp_free(o);
+        Py_DECREF(tp);
+    }
 }
 
 static PyObject *
@@ -2163,9 +2167,20 @@ TaskStepMethWrapper_new(TaskObj *task, PyObject *arg)
 {
     asyncio_state *state = get_asyncio_state_by_def((PyObject *)task);
     TaskStepMethWrapper *o;
-    o = PyObject_GC_New(TaskStepMethWrapper, state->TaskStepMethWrapper_Type);
+    o = _Py_FREELIST_POP(TaskStepMethWrapper, task_step_wrappers);
     if (o == NULL) {
-        return NULL;
+        o = PyObject_GC_New(TaskStepMethWrapper,
+                            state->TaskStepMethWrapper_Type);
+        if (o == NULL) {
+            return NULL;
+        }
+    }
+    else if (Py_TYPE(o) != state->TaskStepMethWrapper_Type) {
+        // Freed by another instance of the module.
+        PyTypeObject *tp = Py_TYPE(o);
+        Py_SET_TYPE(o, (PyTypeObject *)Py_NewRef(
+                        state->TaskStepMethWrapper_Type));
+        Py_DECREF(tp);
     }
 
     o->sw_task = (TaskObj*)Py_NewRef(task);
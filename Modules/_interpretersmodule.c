@@ -18,7 +18,9 @@
 
 #include "marshal.h"              // PyMarshal_ReadObjectFromString()
 
+#define REGISTERS_HEAP_TYPES
 #include "_interpreters_common.h"
+#undef REGISTERS_HEAP_TYPES
 
 #include "clinic/_interpretersmodule.c.h"
 
@@ -318,6 +320,213 @@ register_memoryview_xid(PyObject *mod, PyTypeObject **p_state)
 }
 
 
+/* Shared Buffers ***********************************************************/
+
+/* A SharedBuffer is an immutable buffer whose memory is owned by the
+ * runtime rather than by any one interpreter.  The data is copied once,
+ * when the SharedBuffer is created.  After that, sending it to another
+ * interpreter only creates a new small SharedBuffer object there, which
+ * refers to the same memory.
+ *
+ * Unlike with a shared memoryview, nothing ever has to be released in the
+ * interpreter that created the buffer.  The memory is reference-counted
+ * atomically and freed by whichever interpreter drops the last reference,
+ * so the buffer stays valid after the creating interpreter is destroyed.
+ */
+
+typedef struct {
+    Py_ssize_t refcount;
+    Py_ssize_t len;
+    char data[1];
+} _sharedbuffer_block;
+
+static _sharedbuffer_block *
+_sharedbuffer_block_new(const void *buf, Py_ssize_t len)
+{
+    _sharedbuffer_block *block =
+        PyMem_RawMalloc(offsetof(_sharedbuffer_block, data) + len + 1);
+    if (block == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    block->refcount = 1;
+    block->len = len;
+    memcpy(block->data, buf, len);
+    block->data[len] = '\0';
+    return block;
+}
+
+static void
+_sharedbuffer_block_incref(_sharedbuffer_block *block)
+{
+    _Py_atomic_add_ssize(&block->refcount, 1);
+}
+
+static void
+_sharedbuffer_block_decref(void *data)
+{
+    _sharedbuffer_block *block = (_sharedbuffer_block *)data;
+    if (_Py_atomic_add_ssize(&block->refcount, -1) == 1) {
+        PyMem_RawFree(block);
+    }
+}
+
+typedef struct {
+    PyObject_HEAD
+    _sharedbuffer_block *block;
+} sharedbuffer;
+
+static PyObject *
+sharedbuffer_from_block(PyTypeObject *cls, _sharedbuffer_block *block)
+{
+    sharedbuffer *self = (sharedbuffer *)cls->tp_alloc(cls, 0);
+    if (self == NULL) {
+        return NULL;
+    }
+    /* On success, this steals the reference to block. */
+    self->block = block;
+    return (PyObject *)self;
+}
+
+static PyObject *
+sharedbuffer_new(PyTypeObject *cls, PyObject *args, PyObject *kwds)
+{
+    PyObject *data;
+    if (!_PyArg_NoKeywords("SharedBuffer", kwds)) {
+        return NULL;
+    }
+    if (!PyArg_UnpackTuple(args, "SharedBuffer", 1, 1, &data)) {
+        return NULL;
+    }
+    Py_buffer view;
+    if (PyObject_GetBuffer(data, &view, PyBUF_SIMPLE) < 0) {
+        return NULL;
+    }
+    _sharedbuffer_block *block = _sharedbuffer_block_new(view.buf, view.len);
+    PyBuffer_Release(&view);
+    if (block == NULL) {
+        return NULL;
+    }
+    PyObject *self = sharedbuffer_from_block(cls, block);
+    if (self == NULL) {
+        _sharedbuffer_block_decref(block);
+    }
+    return self;
+}
+
+static void
+sharedbuffer_dealloc(PyObject *op)
+{
+    sharedbuffer *self = (sharedbuffer *)op;
+    PyTypeObject *tp = Py_TYPE(self);
+    if (self->block != NULL) {
+        _sharedbuffer_block_decref(self->block);
+    }
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+static int
+sharedbuffer_getbuf(PyObject *op, Py_buffer *view, int flags)
+{
+    sharedbuffer *self = (sharedbuffer *)op;
+    return PyBuffer_FillInfo(view, op, self->block->data, self->block->len,
+                             1, flags);
+}
+
+static Py_ssize_t
+sharedbuffer_length(PyObject *op)
+{
+    sharedbuffer *self = (sharedbuffer *)op;
+    return self->block->len;
+}
+
+static PyObject *
+sharedbuffer_repr(PyObject *op)
+{
+    sharedbuffer *self = (sharedbuffer *)op;
+    return PyUnicode_FromFormat("<%s object at %p, %zd bytes>",
+                                _PyType_Name(Py_TYPE(self)), self,
+                                self->block->len);
+}
+
+PyDoc_STRVAR(sharedbuffer_doc,
+"SharedBuffer(data, /)\n\
+\n\
+An immutable copy of a bytes-like object which can be sent to other\n\
+interpreters without copying it again.");
+
+static PyType_Slot SharedBufferType_slots[] = {
+    {Py_tp_doc, (void *)sharedbuffer_doc},
+    {Py_tp_new, sharedbuffer_new},
+    {Py_tp_dealloc, sharedbuffer_dealloc},
+    {Py_tp_repr, sharedbuffer_repr},
+    {Py_mp_length, sharedbuffer_length},
+    {Py_bf_getbuffer, sharedbuffer_getbuf},
+    {0, NULL},
+};
+
+static PyType_Spec SharedBufferType_spec = {
+    .name = MODULE_NAME_STR ".SharedBuffer",
+    .basicsize = sizeof(sharedbuffer),
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE,
+    .slots = SharedBufferType_slots,
+};
+
+
+static PyTypeObject * _get_current_sharedbuffer_type(void);
+
+static PyObject *
+_sharedbuffer_from_xid(_PyXIData_t *data)
+{
+    _sharedbuffer_block *block = (_sharedbuffer_block *)_PyXIData_DATA(data);
+    assert(block != NULL);
+    PyTypeObject *cls = _get_current_sharedbuffer_type();
+    if (cls == NULL) {
+        return NULL;
+    }
+    _sharedbuffer_block_incref(block);
+    PyObject *obj = sharedbuffer_from_block(cls, block);
+    if (obj == NULL) {
+        _sharedbuffer_block_decref(block);
+    }
+    return obj;
+}
+
+static int
+_sharedbuffer_shared(PyThreadState *tstate, PyObject *obj, _PyXIData_t *data)
+{
+    /* The cross-interpreter data holds its own reference to the memory,
+     * which is dropped when the data is released, in any interpreter. */
+    _sharedbuffer_block *block = ((sharedbuffer *)obj)->block;
+    _sharedbuffer_block_incref(block);
+    _PyXIData_Init(data, tstate->interp, block, NULL, _sharedbuffer_from_xid);
+    data->free = _sharedbuffer_block_decref;
+    return 0;
+}
+
+static int
+register_sharedbuffer_xid(PyObject *mod, PyTypeObject **p_state)
+{
+    assert(*p_state == NULL);
+    PyTypeObject *cls = (PyTypeObject *)PyType_FromModuleAndSpec(
+                mod, &SharedBufferType_spec, NULL);
+    if (cls == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(mod, cls) < 0) {
+        Py_DECREF(cls);
+        return -1;
+    }
+    if (ensure_xid_class(cls, GETDATA(_sharedbuffer_shared)) < 0) {
+        Py_DECREF(cls);
+        return -1;
+    }
+    *p_state = cls;
+    return 0;
+}
+
+
 
 /* module state *************************************************************/
 
@@ -326,6 +535,7 @@ typedef struct {
 
     /* heap types */
     PyTypeObject *XIBufferViewType;
+    PyTypeObject *SharedBufferType;
 } module_state;
 
 static inline module_state *
@@ -357,6 +567,7 @@ traverse_module_state(module_state *state, visitproc visit, void *arg)
 {
     /* heap types */
     Py_VISIT(state->XIBufferViewType);
+    Py_VISIT(state->SharedBufferType);
 
     return 0;
 }
@@ -366,6 +577,10 @@ clear_module_state(module_state *state)
 {
     /* heap types */
     Py_CLEAR(state->XIBufferViewType);
+    if (state->SharedBufferType != NULL) {
+        (void)clear_xid_class(state->SharedBufferType);
+        Py_CLEAR(state->SharedBufferType);
+    }
 
     return 0;
 }
@@ -381,6 +596,16 @@ _get_current_xibufferview_type(void)
     return state->XIBufferViewType;
 }
 
+static PyTypeObject *
+_get_current_sharedbuffer_type(void)
+{
+    module_state *state = _get_current_module_state();
+    if (state == NULL) {
+        return NULL;
+    }
+    return state->SharedBufferType;
+}
+
 
 /* interpreter-specific code ************************************************/
 
@@ -1626,6 +1851,9 @@ module_exec(PyObject *mod)
     if (register_memoryview_xid(mod, &state->XIBufferViewType) < 0) {
         goto error;
     }
+    if (register_sharedbuffer_xid(mod, &state->SharedBufferType) < 0) {
+        goto error;
+    }
 
     return 0;
 
@@ -59,6 +59,9 @@ typedef struct _PyEncoderObject {
     char skipkeys;
     int allow_nan;
     int (*fast_encode)(PyUnicodeWriter *, PyObject *);
+    /* Maps str keys to their encoded form followed by key_separator,
+       or NULL if the keys are encoded by a Python function. */
+    PyObject *key_memo;
 } PyEncoderObject;
 
 #define PyEncoderObject_CAST(op)    ((PyEncoderObject *)(op))
@@ -468,6 +471,42 @@ _build_rval_index_tuple(PyObject *rval, Py_ssize_t idx) {
     return tpl;
 }
 
+/* Masks used to test all the bytes of a machine word at once. */
+#define UCS1_ONES ((size_t)-1 / 0xff)
+#define UCS1_HIGHS (UCS1_ONES * 0x80)
+/* Non-zero if any byte of v is zero. */
+#define UCS1_HAS_ZERO(v) (((v) - UCS1_ONES) & ~(v) & UCS1_HIGHS)
+/* Non-zero if any byte of v is less than n (n <= 0x80). */
+#define UCS1_HAS_LESS(v, n) (((v) - UCS1_ONES * (n)) & ~(v) & UCS1_HIGHS)
+
+/* Return the index of the first word in s[start:end] which may contain a
+   quote, a backslash or a control character.  The caller must examine the
+   characters from that index one at a time.  Most strings in JSON documents
+   contain none of these, so skipping over a word at a time makes the
+   common case much faster for ASCII and Latin-1 input. */
+static Py_ssize_t
+skip_plain_ucs1(const Py_UCS1 *s, Py_ssize_t start, Py_ssize_t end)
+{
+    Py_ssize_t i = start;
+    while (end - i >= (Py_ssize_t)SIZEOF_SIZE_T) {
+        size_t v;
+        memcpy(&v, s + i, SIZEOF_SIZE_T);
+        if (UCS1_HAS_ZERO(v ^ (UCS1_ONES * '"')) |
+            UCS1_HAS_ZERO(v ^ (UCS1_ONES * '\\')) |
+            UCS1_HAS_LESS(v, 0x20))
+        {
+            break;
+        }
+        i += SIZEOF_SIZE_T;
+    }
+    return i;
+}
+
+#undef UCS1_ONES
+#undef UCS1_HIGHS
+#undef UCS1_HAS_ZERO
+#undef UCS1_HAS_LESS
+
 static PyObject *
 scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next_end_ptr)
 {
@@ -502,7 +541,11 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
         {
             // Use tight scope variable to help register allocation.
             Py_UCS4 d = 0;
-            for (next = end; next < len; next++) {
+            next = end;
+            if (kind == PyUnicode_1BYTE_KIND) {
+                next = skip_plain_ucs1((const Py_UCS1 *)buf, end, len);
+            }
+            for (; next < len; next++) {
                 d = PyUnicode_READ(kind, buf, next);
                 if (d == '"' || d == '\\') {
                     break;
@@ -1344,6 +1387,13 @@ encoder_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
             s->fast_encode = write_escaped_unicode;
         }
     }
+    if (s->fast_encode) {
+        s->key_memo = PyDict_New();
+        if (s->key_memo == NULL) {
+            Py_DECREF(s);
+            return NULL;
+        }
+    }
 
     return (PyObject *)s;
 }
@@ -1464,9 +1514,15 @@ encoder_call(PyObject *op, PyObject *args, PyObject *kwds)
     if (encoder_listencode_obj(self, writer, obj, indent_level, indent_cache)) {
         PyUnicodeWriter_Discard(writer);
         Py_XDECREF(indent_cache);
+        if (self->key_memo != NULL) {
+            PyDict_Clear(self->key_memo);
+        }
         return NULL;
     }
     Py_XDECREF(indent_cache);
+    if (self->key_memo != NULL) {
+        PyDict_Clear(self->key_memo);
+    }
 
     PyObject *str = PyUnicodeWriter_Finish(writer);
     if (str == NULL) {
@@ -1656,6 +1712,65 @@ encoder_listencode_obj(PyEncoderObject *s, PyUnicodeWriter *writer,
     }
 }
 
+/* Stop adding keys to the memo once it holds this many distinct keys, so
+   that encoding a few huge dicts with unique keys does not pay for the memo.
+   Keys that are already in the memo keep using it. */
+#define KEY_MEMO_MAX_SIZE 256
+
+static int
+encoder_write_memoized_key(PyEncoderObject *s, PyUnicodeWriter *writer,
+                           PyObject *key)
+{
+    /* Write the JSON representation of the str key followed by the key
+       separator.  Most documents repeat the same keys in many objects, so
+       the result is memoized instead of escaping the key every time.  A key
+       is only recorded as seen the first time, and encoded into the memo
+       when it is seen again. */
+    PyObject *encoded;
+    int seen = PyDict_GetItemRef(s->key_memo, key, &encoded);
+    if (seen < 0) {
+        return -1;
+    }
+    if (seen) {
+        if (encoded != Py_None) {
+            return _steal_accumulate(writer, encoded);
+        }
+        Py_DECREF(encoded);
+    }
+    else {
+        if (PyDict_GET_SIZE(s->key_memo) < KEY_MEMO_MAX_SIZE &&
+            PyDict_SetItem(s->key_memo, key, Py_None) < 0)
+        {
+            return -1;
+        }
+        if (s->fast_encode(writer, key) < 0) {
+            return -1;
+        }
+        return PyUnicodeWriter_WriteStr(writer, s->key_separator);
+    }
+
+    PyUnicodeWriter *keywriter = PyUnicodeWriter_Create(
+        PyUnicode_GET_LENGTH(key) + 2 + PyUnicode_GET_LENGTH(s->key_separator));
+    if (keywriter == NULL) {
+        return -1;
+    }
+    if (s->fast_encode(keywriter, key) < 0 ||
+        PyUnicodeWriter_WriteStr(keywriter, s->key_separator) < 0)
+    {
+        PyUnicodeWriter_Discard(keywriter);
+        return -1;
+    }
+    encoded = PyUnicodeWriter_Finish(keywriter);
+    if (encoded == NULL) {
+        return -1;
+    }
+    if (PyDict_SetItem(s->key_memo, key, encoded) < 0) {
+        Py_DECREF(encoded);
+        return -1;
+    }
+    return _steal_accumulate(writer, encoded);
+}
+
 static int
 encoder_encode_key_value(PyEncoderObject *s, PyUnicodeWriter *writer, bool *first,
                          PyObject *dct, PyObject *key, PyObject *value,
@@ -1709,15 +1824,20 @@ encoder_encode_key_value(PyEncoderObject *s, PyUnicodeWriter *writer, bool *firs
         }
     }
 
-    rv = encoder_write_string(s, writer, keystr);
+    if (s->key_memo != NULL && PyUnicode_CheckExact(keystr)) {
+        rv = encoder_write_memoized_key(s, writer, keystr);
+    }
+    else {
+        rv = encoder_write_string(s, writer, keystr);
+        if (rv == 0) {
+            rv = PyUnicodeWriter_WriteStr(writer, s->key_separator);
+        }
+    }
     Py_DECREF(keystr);
 
     if (rv < 0) {
         return -1;
     }
-    if (PyUnicodeWriter_WriteStr(writer, s->key_separator) < 0) {
-        return -1;
-    }
     if (encoder_listencode_obj(s, writer, value, indent_level, indent_cache) < 0) {
         _PyErr_FormatNote("when serializing %T item %R", dct, key);
         return -1;
@@ -2022,6 +2142,7 @@ encoder_traverse(PyObject *op, visitproc visit, void *arg)
     Py_VISIT(self->indent);
     Py_VISIT(self->key_separator);
     Py_VISIT(self->item_separator);
+    Py_VISIT(self->key_memo);
     return 0;
 }
 
@@ -2036,6 +2157,7 @@ encoder_clear(PyObject *op)
     Py_CLEAR(self->indent);
     Py_CLEAR(self->key_separator);
     Py_CLEAR(self->item_separator);
+    Py_CLEAR(self->key_memo);
     return 0;
 }
 
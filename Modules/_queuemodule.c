@@ -4,8 +4,10 @@
 
 #include "Python.h"
 #include "pycore_ceval.h"         // Py_MakePendingCalls()
+#include "pycore_critical_section.h" // _Py_CRITICAL_SECTION_ASSERT_OBJECT_LOCKED()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "pycore_parking_lot.h"
+#include "pycore_pyatomic_ft_wrappers.h" // FT_ATOMIC_LOAD_SSIZE_RELAXED()
 #include "pycore_time.h"          // _PyTime_FromSecondsObject()
 #include "pycore_weakref.h"       // FT_CLEAR_WEAKREFS()
 
@@ -39,10 +41,12 @@ typedef struct {
 
     PyObject **items;
 
-    // Total number of items that may be stored
+    // Total number of items that may be stored. Always a power of two, so
+    // that indices can wrap around with a mask rather than a division.
     Py_ssize_t items_cap;
 
-    // Number of items stored
+    // Number of items stored. Also read without the critical section by
+    // empty() and qsize().
     Py_ssize_t num_items;
 } RingBuf;
 
@@ -65,7 +69,7 @@ static PyObject *
 RingBuf_At(RingBuf *buf, Py_ssize_t idx)
 {
     assert(idx >= 0 && idx < buf->num_items);
-    return buf->items[(buf->get_idx + idx) % buf->items_cap];
+    return buf->items[(buf->get_idx + idx) & (buf->items_cap - 1)];
 }
 
 static void
@@ -78,9 +82,9 @@ RingBuf_Fini(RingBuf *buf)
     buf->items = NULL;
     buf->put_idx = 0;
     buf->get_idx = 0;
-    buf->num_items = 0;
+    FT_ATOMIC_STORE_SSIZE_RELAXED(buf->num_items, 0);
     buf->items_cap = 0;
-    for (Py_ssize_t n = num_items; n > 0; idx = (idx + 1) % cap, n--) {
+    for (Py_ssize_t n = num_items; n > 0; idx = (idx + 1) & (cap - 1), n--) {
         Py_DECREF(items[idx]);
     }
     PyMem_Free(items);
@@ -94,6 +98,7 @@ static int
 resize_ringbuf(RingBuf *buf, Py_ssize_t capacity)
 {
     Py_ssize_t new_capacity = Py_MAX(INITIAL_RING_BUF_CAPACITY, capacity);
+    assert((new_capacity & (new_capacity - 1)) == 0);
     if (new_capacity == buf->items_cap) {
         return 0;
     }
@@ -148,8 +153,8 @@ RingBuf_Get(RingBuf *buf)
 
     PyObject *item = buf->items[buf->get_idx];
     buf->items[buf->get_idx] = NULL;
-    buf->get_idx = (buf->get_idx + 1) % buf->items_cap;
-    buf->num_items--;
+    buf->get_idx = (buf->get_idx + 1) & (buf->items_cap - 1);
+    FT_ATOMIC_STORE_SSIZE_RELAXED(buf->num_items, buf->num_items - 1);
     return item;
 }
 
@@ -169,21 +174,23 @@ RingBuf_Put(RingBuf *buf, PyObject *item)
         }
     }
     buf->items[buf->put_idx] = item;
-    buf->put_idx = (buf->put_idx + 1) % buf->items_cap;
-    buf->num_items++;
+    buf->put_idx = (buf->put_idx + 1) & (buf->items_cap - 1);
+    FT_ATOMIC_STORE_SSIZE_RELAXED(buf->num_items, buf->num_items + 1);
     return 0;
 }
 
+// May be called without holding the queue's critical section, in which
+// case the result is only a snapshot.
 static Py_ssize_t
 RingBuf_Len(RingBuf *buf)
 {
-    return buf->num_items;
+    return FT_ATOMIC_LOAD_SSIZE_RELAXED(buf->num_items);
 }
 
 static bool
 RingBuf_IsEmpty(RingBuf *buf)
 {
-    return buf->num_items == 0;
+    return RingBuf_Len(buf) == 0;
 }
 
 typedef struct {
@@ -343,6 +350,96 @@ _queue_SimpleQueue_put_nowait_impl(simplequeueobject *self, PyObject *item)
     return _queue_SimpleQueue_put_impl(self, item, 0, Py_None);
 }
 
+// Puts every item of the tuple items on the queue.
+//
+// Returns 0 on success or -1 if the buffer failed to grow.
+static int
+simplequeue_put_many_lock_held(simplequeueobject *self, PyObject *items)
+{
+    _Py_CRITICAL_SECTION_ASSERT_OBJECT_LOCKED(self);
+    Py_ssize_t n = PyTuple_GET_SIZE(items);
+    Py_ssize_t i = 0;
+
+    // Hand items off directly while there are threads waiting
+    for (; i < n && self->has_threads_waiting; i++) {
+        HandoffData data = {
+            .handed_off = 0,
+            .item = Py_NewRef(PyTuple_GET_ITEM(items, i)),
+            .queue = self,
+        };
+        _PyParkingLot_Unpark(&self->has_threads_waiting,
+                             maybe_handoff_item, &data);
+        if (!data.handed_off) {
+            if (RingBuf_Put(&self->buf, data.item) < 0) {
+                Py_DECREF(data.item);
+                return -1;
+            }
+        }
+    }
+    if (i == n) {
+        return 0;
+    }
+
+    // Grow the buffer once for the remaining items
+    RingBuf *buf = &self->buf;
+    Py_ssize_t needed = RingBuf_Len(buf) + (n - i);
+    if (needed > buf->items_cap) {
+        Py_ssize_t capacity = buf->items_cap;
+        while (capacity < needed) {
+            if (capacity > PY_SSIZE_T_MAX / 2) {
+                PyErr_NoMemory();
+                return -1;
+            }
+            capacity *= 2;
+        }
+        if (resize_ringbuf(buf, capacity) < 0) {
+            PyErr_NoMemory();
+            return -1;
+        }
+    }
+    for (; i < n; i++) {
+        int rc = RingBuf_Put(buf, Py_NewRef(PyTuple_GET_ITEM(items, i)));
+        assert(rc == 0);
+        (void)rc;
+    }
+    return 0;
+}
+
+/*[clinic input]
+_queue.SimpleQueue.put_many
+    items: object
+    block: bool = True
+    timeout: object = None
+
+Put all items of an iterable on the queue, in order.
+
+The optional 'block' and 'timeout' arguments are ignored, as this method
+never blocks.  They are provided for compatibility with the Queue class.
+
+[clinic start generated code]*/
+
+static PyObject *
+_queue_SimpleQueue_put_many_impl(simplequeueobject *self, PyObject *items,
+                                 int block, PyObject *timeout)
+/*[clinic end generated code: output=266209210f316aaa input=11c80ffec9a8f87a]*/
+{
+    // Collect the items first, so that no arbitrary code runs while the
+    // queue is locked.
+    PyObject *tuple = PySequence_Tuple(items);
+    if (tuple == NULL) {
+        return NULL;
+    }
+    int res;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    res = simplequeue_put_many_lock_held(self, tuple);
+    Py_END_CRITICAL_SECTION();
+    Py_DECREF(tuple);
+    if (res < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
 static PyObject *
 empty_error(PyTypeObject *cls)
 {
@@ -474,6 +571,51 @@ _queue_SimpleQueue_get_nowait_impl(simplequeueobject *self,
 
 /*[clinic input]
 @critical_section
+_queue.SimpleQueue.get_many
+
+    cls: defining_class
+    /
+    max_items: Py_ssize_t
+    block: bool = True
+    timeout as timeout_obj: object = None
+
+Remove and return a list of up to 'max_items' items from the queue.
+
+Wait for the first item as get() does, then also take the items that
+are immediately available, up to 'max_items' in total.  The list is
+never empty.
+[clinic start generated code]*/
+
+static PyObject *
+_queue_SimpleQueue_get_many_impl(simplequeueobject *self, PyTypeObject *cls,
+                                 Py_ssize_t max_items, int block,
+                                 PyObject *timeout_obj)
+/*[clinic end generated code: output=5db4d0fe54081e21 input=cd3351a56a0baebe]*/
+{
+    if (max_items < 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "'max_items' must be a positive integer");
+        return NULL;
+    }
+    PyObject *item = _queue_SimpleQueue_get_impl(self, cls, block,
+                                                 timeout_obj);
+    if (item == NULL) {
+        return NULL;
+    }
+    Py_ssize_t count = Py_MIN(max_items - 1, RingBuf_Len(&self->buf)) + 1;
+    PyObject *result = PyList_New(count);
+    if (result == NULL) {
+        Py_DECREF(item);
+        return NULL;
+    }
+    PyList_SET_ITEM(result, 0, item);
+    for (Py_ssize_t i = 1; i < count; i++) {
+        PyList_SET_ITEM(result, i, RingBuf_Get(&self->buf));
+    }
+    return result;
+}
+
+/*[clinic input]
 _queue.SimpleQueue.empty -> bool
 
 Return True if the queue is empty, False otherwise (not reliable!).
@@ -481,13 +623,12 @@ Return True if the queue is empty, False otherwise (not reliable!).
 
 static int
 _queue_SimpleQueue_empty_impl(simplequeueobject *self)
-/*[clinic end generated code: output=1a02a1b87c0ef838 input=96cb22df5a67d831]*/
+/*[clinic end generated code: output=1a02a1b87c0ef838 input=1a98431c45fd66f9]*/
 {
     return RingBuf_IsEmpty(&self->buf);
 }
 
 /*[clinic input]
-@critical_section
 _queue.SimpleQueue.qsize -> Py_ssize_t
 
 Return the approximate size of the queue (not reliable!).
@@ -495,7 +636,7 @@ Return the approximate size of the queue (not reliable!).
 
 static Py_ssize_t
 _queue_SimpleQueue_qsize_impl(simplequeueobject *self)
-/*[clinic end generated code: output=f9dcd9d0a90e121e input=e218623cb8c16a79]*/
+/*[clinic end generated code: output=f9dcd9d0a90e121e input=7a74852b407868a1]*/
 {
     return RingBuf_Len(&self->buf);
 }
@@ -546,8 +687,10 @@ queue_free(void *m)
 static PyMethodDef simplequeue_methods[] = {
     _QUEUE_SIMPLEQUEUE_EMPTY_METHODDEF
     _QUEUE_SIMPLEQUEUE_GET_METHODDEF
+    _QUEUE_SIMPLEQUEUE_GET_MANY_METHODDEF
     _QUEUE_SIMPLEQUEUE_GET_NOWAIT_METHODDEF
     _QUEUE_SIMPLEQUEUE_PUT_METHODDEF
+    _QUEUE_SIMPLEQUEUE_PUT_MANY_METHODDEF
     _QUEUE_SIMPLEQUEUE_PUT_NOWAIT_METHODDEF
     _QUEUE_SIMPLEQUEUE_QSIZE_METHODDEF
     _QUEUE_SIMPLEQUEUE___SIZEOF___METHODDEF
@@ -6,7 +6,7 @@ preserve
 #  include "pycore_gc.h"          // PyGC_Head
 #  include "pycore_runtime.h"     // _Py_ID()
 #endif
-#include "pycore_abstract.h"      // _Py_convert_optional_to_ssize_t()
+#include "pycore_abstract.h"      // _PyNumber_Index()
 #include "pycore_modsupport.h"    // _PyArg_UnpackKeywords()
 
 PyDoc_STRVAR(gc_enable__doc__,
@@ -287,6 +287,72 @@ gc_get_threshold(PyObject *module, PyObject *Py_UNUSED(ignored))
     return gc_get_threshold_impl(module);
 }
 
+PyDoc_STRVAR(gc_set_increment_limit__doc__,
+"set_increment_limit($module, limit, /)\n"
+"--\n"
+"\n"
+"Limit the number of objects examined by each incremental collection.\n"
+"\n"
+"Zero means that there is no limit.");
+
+#define GC_SET_INCREMENT_LIMIT_METHODDEF    \
+    {"set_increment_limit", (PyCFunction)gc_set_increment_limit, METH_O, gc_set_increment_limit__doc__},
+
+static PyObject *
+gc_set_increment_limit_impl(PyObject *module, Py_ssize_t limit);
+
+static PyObject *
+gc_set_increment_limit(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t limit;
+
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(arg);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        limit = ival;
+    }
+    return_value = gc_set_increment_limit_impl(module, limit);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_get_increment_limit__doc__,
+"get_increment_limit($module, /)\n"
+"--\n"
+"\n"
+"Return the limit on the objects examined by each incremental collection.");
+
+#define GC_GET_INCREMENT_LIMIT_METHODDEF    \
+    {"get_increment_limit", (PyCFunction)gc_get_increment_limit, METH_NOARGS, gc_get_increment_limit__doc__},
+
+static Py_ssize_t
+gc_get_increment_limit_impl(PyObject *module);
+
+static PyObject *
+gc_get_increment_limit(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t _return_value;
+
+    _return_value = gc_get_increment_limit_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromSsize_t(_return_value);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(gc_get_count__doc__,
 "get_count($module, /)\n"
 "--\n"
@@ -583,4 +649,4 @@ gc_get_freeze_count(PyObject *module, PyObject *Py_UNUSED(ignored))
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=19738854607938db input=a9049054013a1b77]*/
+/*[clinic end generated code: output=359c64a1f3d66ba0 input=a9049054013a1b77]*/
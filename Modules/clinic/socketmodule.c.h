@@ -29,6 +29,60 @@ _socket_socket_close(PyObject *s, PyObject *Py_UNUSED(ignored))
     return _socket_socket_close_impl((PySocketSockObject *)s);
 }
 
+#if defined(HAVE_RECVMMSG)
+
+PyDoc_STRVAR(_socket_socket_recvmmsg_into__doc__,
+"recvmmsg_into($self, buffers, flags=0, /)\n"
+"--\n"
+"\n"
+"Receive several datagrams with a single system call.\n"
+"\n"
+"Each datagram is written into the next buffer of the buffers argument,\n"
+"which must be an iterable of objects that export writable buffers\n"
+"(e.g. bytearray objects).  The call waits until at least one datagram\n"
+"is available, then returns without blocking again once the datagrams\n"
+"already queued on the socket have been received.  The flags argument\n"
+"defaults to 0 and has the same meaning as for recv().\n"
+"\n"
+"Return a list of (nbytes, msg_flags, address) tuples, one for each\n"
+"datagram received, in the order of the buffers they were written to.\n"
+"A datagram larger than its buffer is truncated and has MSG_TRUNC set\n"
+"in msg_flags.");
+
+#define _SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF    \
+    {"recvmmsg_into", _PyCFunction_CAST(_socket_socket_recvmmsg_into), METH_FASTCALL, _socket_socket_recvmmsg_into__doc__},
+
+static PyObject *
+_socket_socket_recvmmsg_into_impl(PySocketSockObject *s,
+                                  PyObject *buffers_arg, int flags);
+
+static PyObject *
+_socket_socket_recvmmsg_into(PyObject *s, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *buffers_arg;
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("recvmmsg_into", nargs, 1, 2)) {
+        goto exit;
+    }
+    buffers_arg = args[0];
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[1]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    return_value = _socket_socket_recvmmsg_into_impl((PySocketSockObject *)s, buffers_arg, flags);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_RECVMMSG) */
+
 PyDoc_STRVAR(_socket_socket_send__doc__,
 "send($self, data, flags=0, /)\n"
 "--\n"
@@ -193,6 +247,61 @@ exit:
 
 #endif /* defined(CMSG_LEN) */
 
+#if defined(HAVE_SENDMMSG)
+
+PyDoc_STRVAR(_socket_socket_sendmmsg__doc__,
+"sendmmsg($self, buffers, flags=0, address=None, /)\n"
+"--\n"
+"\n"
+"Send several datagrams with a single system call.\n"
+"\n"
+"The buffers argument is an iterable of bytes-like objects, each of\n"
+"which is sent as a separate datagram.  The flags argument defaults to\n"
+"0 and has the same meaning as for send().  If address is supplied and\n"
+"not None, it sets the destination address of every datagram.\n"
+"\n"
+"Return the number of datagrams sent; this may be less than\n"
+"len(buffers) if the network is busy.");
+
+#define _SOCKET_SOCKET_SENDMMSG_METHODDEF    \
+    {"sendmmsg", _PyCFunction_CAST(_socket_socket_sendmmsg), METH_FASTCALL, _socket_socket_sendmmsg__doc__},
+
+static PyObject *
+_socket_socket_sendmmsg_impl(PySocketSockObject *s, PyObject *data_arg,
+                             int flags, PyObject *addr_arg);
+
+static PyObject *
+_socket_socket_sendmmsg(PyObject *s, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *data_arg;
+    int flags = 0;
+    PyObject *addr_arg = Py_None;
+
+    if (!_PyArg_CheckPositional("sendmmsg", nargs, 1, 3)) {
+        goto exit;
+    }
+    data_arg = args[0];
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[1]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    addr_arg = args[2];
+skip_optional:
+    return_value = _socket_socket_sendmmsg_impl((PySocketSockObject *)s, data_arg, flags, addr_arg);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_SENDMMSG) */
+
 static int
 sock_initobj_impl(PySocketSockObject *self, int family, int type, int proto,
                   PyObject *fdobj);
@@ -526,10 +635,18 @@ exit:
 
 #endif /* (defined(HAVE_IF_NAMEINDEX) || defined(MS_WINDOWS)) */
 
+#ifndef _SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF
+    #define _SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF
+#endif /* !defined(_SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF) */
+
 #ifndef _SOCKET_SOCKET_SENDMSG_METHODDEF
     #define _SOCKET_SOCKET_SENDMSG_METHODDEF
 #endif /* !defined(_SOCKET_SOCKET_SENDMSG_METHODDEF) */
 
+#ifndef _SOCKET_SOCKET_SENDMMSG_METHODDEF
+    #define _SOCKET_SOCKET_SENDMMSG_METHODDEF
+#endif /* !defined(_SOCKET_SOCKET_SENDMMSG_METHODDEF) */
+
 #ifndef _SOCKET_INET_NTOA_METHODDEF
     #define _SOCKET_INET_NTOA_METHODDEF
 #endif /* !defined(_SOCKET_INET_NTOA_METHODDEF) */
@@ -541,4 +658,4 @@ exit:
 #ifndef _SOCKET_IF_INDEXTONAME_METHODDEF
     #define _SOCKET_IF_INDEXTONAME_METHODDEF
 #endif /* !defined(_SOCKET_IF_INDEXTONAME_METHODDEF) */
-/*[clinic end generated code: output=36051ebf6ad1e6f8 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=3a877731e055efb3 input=a9049054013a1b77]*/
@@ -185,6 +185,45 @@ gc_get_threshold_impl(PyObject *module)
                          0);
 }
 
+/*[clinic input]
+gc.set_increment_limit
+
+    limit: Py_ssize_t
+    /
+
+Limit the number of objects examined by each incremental collection.
+
+Zero means that there is no limit.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_increment_limit_impl(PyObject *module, Py_ssize_t limit)
+/*[clinic end generated code: output=ba18e3746b31f6df input=7740c487c089bcd5]*/
+{
+    if (limit < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "increment limit must be non-negative");
+        return NULL;
+    }
+    GCState *gcstate = get_gc_state();
+    gcstate->increment_limit = limit;
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_increment_limit -> Py_ssize_t
+
+Return the limit on the objects examined by each incremental collection.
+[clinic start generated code]*/
+
+static Py_ssize_t
+gc_get_increment_limit_impl(PyObject *module)
+/*[clinic end generated code: output=c18f35233ad35f04 input=410ca9aff169bec3]*/
+{
+    GCState *gcstate = get_gc_state();
+    return gcstate->increment_limit;
+}
+
 /*[clinic input]
 gc.get_count
 
@@ -358,13 +397,26 @@ gc_get_stats_impl(PyObject *module)
     for (i = 0; i < NUM_GENERATIONS; i++) {
         PyObject *dict;
         st = &stats[i];
-        dict = Py_BuildValue("{snsnsnsnsd}",
+#ifdef Py_GIL_DISABLED
+        dict = Py_BuildValue("{snsnsnsnsdsdsd}",
+                             "collections", st->collections,
+                             "collected", st->collected,
+                             "uncollectable", st->uncollectable,
+                             "candidates", st->candidates,
+                             "duration", st->duration,
+                             "mark_duration", st->mark_duration,
+                             "pause_duration", st->pause_duration
+                            );
+#else
+        dict = Py_BuildValue("{snsnsnsnsdsd}",
                              "collections", st->collections,
                              "collected", st->collected,
                              "uncollectable", st->uncollectable,
                              "candidates", st->candidates,
-                             "duration", st->duration
+                             "duration", st->duration,
+                             "mark_duration", st->mark_duration
                             );
+#endif
         if (dict == NULL)
             goto error;
         if (PyList_Append(result, dict)) {
@@ -480,6 +532,8 @@ PyDoc_STRVAR(gc__doc__,
 "get_debug() -- Get debugging flags.\n"
 "set_threshold() -- Set the collection thresholds.\n"
 "get_threshold() -- Return the current collection thresholds.\n"
+"set_increment_limit() -- Limit the work of each incremental collection.\n"
+"get_increment_limit() -- Return the limit set by set_increment_limit().\n"
 "get_objects() -- Return a list of all objects tracked by the collector.\n"
 "is_tracked() -- Returns true if a given object is tracked.\n"
 "is_finalized() -- Returns true if a given object has been already finalized.\n"
@@ -498,6 +552,8 @@ static PyMethodDef GcMethods[] = {
     GC_GET_COUNT_METHODDEF
     GC_SET_THRESHOLD_METHODDEF
     GC_GET_THRESHOLD_METHODDEF
+    GC_SET_INCREMENT_LIMIT_METHODDEF
+    GC_GET_INCREMENT_LIMIT_METHODDEF
     GC_COLLECT_METHODDEF
     GC_GET_OBJECTS_METHODDEF
     GC_GET_STATS_METHODDEF
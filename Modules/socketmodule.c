@@ -4600,6 +4600,153 @@ SCM_RIGHTS mechanism.");
 #endif    /* CMSG_LEN */
 
 
+#ifdef HAVE_RECVMMSG
+struct sock_recvmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_recvmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_recvmmsg *ctx = data;
+
+    ctx->result = recvmmsg(get_sock_fd(s), ctx->msgvec, ctx->vlen,
+                           ctx->flags, NULL);
+    return (ctx->result >= 0);
+}
+
+/*[clinic input]
+_socket.socket.recvmmsg_into
+    self as s: self(type="PySocketSockObject *")
+    buffers as buffers_arg: object
+    flags: int = 0
+    /
+
+Receive several datagrams with a single system call.
+
+Each datagram is written into the next buffer of the buffers argument,
+which must be an iterable of objects that export writable buffers
+(e.g. bytearray objects).  The call waits until at least one datagram
+is available, then returns without blocking again once the datagrams
+already queued on the socket have been received.  The flags argument
+defaults to 0 and has the same meaning as for recv().
+
+Return a list of (nbytes, msg_flags, address) tuples, one for each
+datagram received, in the order of the buffers they were written to.
+A datagram larger than its buffer is truncated and has MSG_TRUNC set
+in msg_flags.
+[clinic start generated code]*/
+
+static PyObject *
+_socket_socket_recvmmsg_into_impl(PySocketSockObject *s,
+                                  PyObject *buffers_arg, int flags)
+/*[clinic end generated code: output=020b90ce0091b16f input=a1efb508a8d80c3c]*/
+{
+    Py_ssize_t i, nitems, nbufs = 0;
+    socklen_t addrbuflen;
+    struct mmsghdr *msgvec = NULL;
+    struct iovec *iovs = NULL;
+    sock_addr_t *addrbufs = NULL;
+    Py_buffer *bufs = NULL;
+    PyObject *fast, *retval = NULL;
+    struct sock_recvmmsg ctx;
+
+    if (!getsockaddrlen(s, &addrbuflen))
+        return NULL;
+
+    if ((fast = PySequence_Fast(buffers_arg,
+                                "recvmmsg_into() argument 1 must be an "
+                                "iterable")) == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError,
+                        "recvmmsg_into() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyList_New(0);
+        goto finally;
+    }
+
+    /* Give every datagram its own iovec and address buffer, and save the
+       Py_buffer structs to release afterwards. */
+    if ((msgvec = PyMem_New(struct mmsghdr, nitems)) == NULL ||
+        (iovs = PyMem_New(struct iovec, nitems)) == NULL ||
+        (addrbufs = PyMem_New(sock_addr_t, nitems)) == NULL ||
+        (bufs = PyMem_New(Py_buffer, nitems)) == NULL)
+    {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgvec, 0, nitems * sizeof(struct mmsghdr));
+    for (; nbufs < nitems; nbufs++) {
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(fast, nbufs),
+                         "w*;recvmmsg_into() argument 1 must be an iterable "
+                         "of single-segment read-write buffers",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        /* See the comment about msg_name in sock_recvmsg_guts(). */
+        memset(&addrbufs[nbufs], 0, addrbuflen);
+        SAS2SA(&addrbufs[nbufs])->sa_family = AF_UNSPEC;
+        msgvec[nbufs].msg_hdr.msg_name = SAS2SA(&addrbufs[nbufs]);
+        msgvec[nbufs].msg_hdr.msg_namelen = addrbuflen;
+        msgvec[nbufs].msg_hdr.msg_iov = &iovs[nbufs];
+        msgvec[nbufs].msg_hdr.msg_iovlen = 1;
+    }
+
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+#ifdef MSG_WAITFORONE
+    /* Only block until the first datagram arrives, like recv() does. */
+    ctx.flags |= MSG_WAITFORONE;
+#endif
+    if (sock_call(s, 0, sock_recvmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    if ((retval = PyList_New(ctx.result)) == NULL)
+        goto finally;
+    for (i = 0; i < ctx.result; i++) {
+        struct msghdr *msg = &msgvec[i].msg_hdr;
+        PyObject *item = Py_BuildValue(
+            "IiN",
+            msgvec[i].msg_len,
+            (int)msg->msg_flags,
+            makesockaddr(get_sock_fd(s), SAS2SA(&addrbufs[i]),
+                         ((msg->msg_namelen > addrbuflen) ?
+                          addrbuflen : msg->msg_namelen),
+                         s->sock_proto));
+        if (item == NULL) {
+            Py_CLEAR(retval);
+            goto finally;
+        }
+        PyList_SET_ITEM(retval, i, item);
+    }
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(bufs);
+    PyMem_Free(addrbufs);
+    PyMem_Free(iovs);
+    PyMem_Free(msgvec);
+    Py_DECREF(fast);
+    return retval;
+}
+#endif    /* HAVE_RECVMMSG */
+
+
 struct sock_send {
     char *buf;
     Py_ssize_t len;
@@ -5120,6 +5267,128 @@ _socket_socket_sendmsg_impl(PySocketSockObject *s, PyObject *data_arg,
 
 #endif    /* CMSG_LEN */
 
+#ifdef HAVE_SENDMMSG
+struct sock_sendmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_sendmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_sendmmsg *ctx = data;
+
+    ctx->result = sendmmsg(get_sock_fd(s), ctx->msgvec, ctx->vlen,
+                           ctx->flags);
+    return (ctx->result >= 0);
+}
+
+/*[clinic input]
+_socket.socket.sendmmsg
+    self as s: self(type="PySocketSockObject *")
+    buffers as data_arg: object
+    flags: int = 0
+    address as addr_arg: object = None
+    /
+
+Send several datagrams with a single system call.
+
+The buffers argument is an iterable of bytes-like objects, each of
+which is sent as a separate datagram.  The flags argument defaults to
+0 and has the same meaning as for send().  If address is supplied and
+not None, it sets the destination address of every datagram.
+
+Return the number of datagrams sent; this may be less than
+len(buffers) if the network is busy.
+[clinic start generated code]*/
+
+static PyObject *
+_socket_socket_sendmmsg_impl(PySocketSockObject *s, PyObject *data_arg,
+                             int flags, PyObject *addr_arg)
+/*[clinic end generated code: output=cf89053900251f88 input=f7c6380d067fb268]*/
+{
+    Py_ssize_t i, nitems, nbufs = 0;
+    sock_addr_t addrbuf;
+    int addrlen = 0;
+    struct mmsghdr *msgvec = NULL;
+    struct iovec *iovs = NULL;
+    Py_buffer *bufs = NULL;
+    PyObject *fast, *retval = NULL;
+    struct sock_sendmmsg ctx;
+
+    /* Parse destination address. */
+    if (addr_arg != Py_None) {
+        if (!getsockaddrarg(s, addr_arg, &addrbuf, &addrlen, "sendmmsg")) {
+            return NULL;
+        }
+    }
+    if (PySys_Audit("socket.sendmmsg", "OO", s, addr_arg) < 0) {
+        return NULL;
+    }
+
+    fast = PySequence_Fast(data_arg,
+                           "sendmmsg() argument 1 must be an iterable");
+    if (fast == NULL) {
+        return NULL;
+    }
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError, "sendmmsg() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyLong_FromLong(0);
+        goto finally;
+    }
+
+    if ((msgvec = PyMem_New(struct mmsghdr, nitems)) == NULL ||
+        (iovs = PyMem_New(struct iovec, nitems)) == NULL ||
+        (bufs = PyMem_New(Py_buffer, nitems)) == NULL)
+    {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgvec, 0, nitems * sizeof(struct mmsghdr));
+    for (; nbufs < nitems; nbufs++) {
+        if (PyObject_GetBuffer(PySequence_Fast_GET_ITEM(fast, nbufs),
+                               &bufs[nbufs], PyBUF_SIMPLE) < 0)
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        if (addrlen > 0) {
+            msgvec[nbufs].msg_hdr.msg_name = &addrbuf;
+            msgvec[nbufs].msg_hdr.msg_namelen = addrlen;
+        }
+        msgvec[nbufs].msg_hdr.msg_iov = &iovs[nbufs];
+        msgvec[nbufs].msg_hdr.msg_iovlen = 1;
+    }
+
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+    if (sock_call(s, 1, sock_sendmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    retval = PyLong_FromLong(ctx.result);
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(bufs);
+    PyMem_Free(iovs);
+    PyMem_Free(msgvec);
+    Py_DECREF(fast);
+    return retval;
+}
+#endif    /* HAVE_SENDMMSG */
+
 #ifdef HAVE_SOCKADDR_ALG
 static PyObject*
 sock_sendmsg_afalg(PyObject *s, PyObject *args, PyObject *kwds)
@@ -5477,6 +5746,8 @@ static PyMethodDef sock_methods[] = {
     {"recvmsg_into", sock_recvmsg_into, METH_VARARGS, recvmsg_into_doc},
     _SOCKET_SOCKET_SENDMSG_METHODDEF
 #endif
+    _SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF
+    _SOCKET_SOCKET_SENDMMSG_METHODDEF
 #ifdef HAVE_SOCKADDR_ALG
     {
         "sendmsg_afalg",
@@ -940,6 +940,7 @@ _PyObject_ClearFreeLists(struct _Py_freelists *freelists, int is_finalization)
     clear_freelist(&freelists->async_gens, is_finalization, free_object);
     clear_freelist(&freelists->async_gen_asends, is_finalization, free_object);
     clear_freelist(&freelists->futureiters, is_finalization, free_object);
+    clear_freelist(&freelists->task_step_wrappers, is_finalization, free_object);
     if (is_finalization) {
         // Only clear object stack chunks during finalization. We use object
         // stacks during GC, so emptying the free-list is counterproductive.
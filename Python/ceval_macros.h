@@ -514,6 +514,25 @@ check_periodics(PyThreadState *tstate) {
     return 0;
 }
 
+// Return a float holding dval. If the stack holds the only reference to
+// one of the operands, that float is overwritten and returned instead of
+// allocating a new one. Used by the tier-2 *_FLOAT_INPLACE uops.
+static inline _PyStackRef
+float_from_double_inplace(double dval, _PyStackRef left, _PyStackRef right)
+{
+    PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+    if (PyStackRef_RefcountOnObject(left) && _PyObject_IsUniquelyReferenced(left_o)) {
+        ((PyFloatObject *)left_o)->ob_fval = dval;
+        return PyStackRef_DUP(left);
+    }
+    PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+    if (PyStackRef_RefcountOnObject(right) && _PyObject_IsUniquelyReferenced(right_o)) {
+        ((PyFloatObject *)right_o)->ob_fval = dval;
+        return PyStackRef_DUP(right);
+    }
+    return PyStackRef_FromPyObjectSteal(PyFloat_FromDouble(dval));
+}
+
 // Mark the generator as executing. Returns true if the state was changed,
 // false if it was already executing or finished.
 static inline bool
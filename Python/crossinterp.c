@@ -14,6 +14,7 @@
 #include "pycore_pythonrun.h"     // _Py_SourceAsString()
 #include "pycore_runtime.h"       // _PyRuntime
 #include "pycore_setobject.h"     // _PySet_NextEntry()
+#include "pycore_tuple.h"         // _PyTuple_ITEMS()
 #include "pycore_typeobject.h"    // _PyStaticType_InitBuiltin()
 
 
@@ -639,25 +639,23 @@ _tuple_shared_free(void* data)
     PyMem_RawFree(shared);
 }
 
-static int
-_tuple_shared(PyThreadState *tstate, PyObject *obj, xidata_fallback_t fallback,
-              _PyXIData_t *xidata)
+static struct _shared_tuple_data *
+_shared_items_new(PyThreadState *tstate, PyObject *const *items,
+                  Py_ssize_t len, xidata_fallback_t fallback,
+                  const char *where)
 {
-    Py_ssize_t len = PyTuple_GET_SIZE(obj);
-    if (len < 0) {
-        return -1;
-    }
     struct _shared_tuple_data *shared = PyMem_RawMalloc(sizeof(struct _shared_tuple_data));
     if (shared == NULL){
         PyErr_NoMemory();
-        return -1;
+        return NULL;
     }
 
     shared->len = len;
     shared->items = (_PyXIData_t **) PyMem_Calloc(shared->len, sizeof(_PyXIData_t *));
     if (shared->items == NULL) {
+        PyMem_RawFree(shared);
         PyErr_NoMemory();
-        return -1;
+        return NULL;
     }
 
     for (Py_ssize_t i = 0; i < shared->len; i++) {
@@ -665,11 +663,10 @@ _tuple_shared(PyThreadState *tstate, PyObject *obj, xidata_fallback_t fallback,
         if (xidata_i == NULL) {
             goto error;  // PyErr_NoMemory already set
         }
-        PyObject *item = PyTuple_GET_ITEM(obj, i);
 
         int res = -1;
-        if (!_Py_EnterRecursiveCallTstate(tstate, " while sharing a tuple")) {
-            res = _PyObject_GetXIData(tstate, item, fallback, xidata_i);
+        if (!_Py_EnterRecursiveCallTstate(tstate, where)) {
+            res = _PyObject_GetXIData(tstate, items[i], fallback, xidata_i);
             _Py_LeaveRecursiveCallTstate(tstate);
         }
         if (res < 0) {
@@ -678,13 +675,119 @@ _tuple_shared(PyThreadState *tstate, PyObject *obj, xidata_fallback_t fallback,
         }
         shared->items[i] = xidata_i;
     }
+    return shared;
+
+error:
+    _tuple_shared_free(shared);
+    return NULL;
+}
+
+static int
+_tuple_shared(PyThreadState *tstate, PyObject *obj, xidata_fallback_t fallback,
+              _PyXIData_t *xidata)
+{
+    struct _shared_tuple_data *shared = _shared_items_new(
+        tstate, _PyTuple_ITEMS(obj), PyTuple_GET_SIZE(obj), fallback,
+        " while sharing a tuple");
+    if (shared == NULL) {
+        return -1;
+    }
     _PyXIData_Init(xidata, tstate->interp, shared, obj, _new_tuple_object);
     _PyXIData_SET_FREE(xidata, _tuple_shared_free);
     return 0;
+}
 
-error:
-    _tuple_shared_free(shared);
-    return -1;
+// frozenset
+
+static PyObject *
+_new_frozenset_object(_PyXIData_t *xidata)
+{
+    PyObject *items = _new_tuple_object(xidata);
+    if (items == NULL) {
+        return NULL;
+    }
+    PyObject *frozenset = PyFrozenSet_New(items);
+    Py_DECREF(items);
+    return frozenset;
+}
+
+static int
+_frozenset_shared(PyThreadState *tstate, PyObject *obj,
+                  xidata_fallback_t fallback, _PyXIData_t *xidata)
+{
+    PyObject *items = PySequence_Tuple(obj);
+    if (items == NULL) {
+        return -1;
+    }
+    struct _shared_tuple_data *shared = _shared_items_new(
+        tstate, _PyTuple_ITEMS(items), PyTuple_GET_SIZE(items), fallback,
+        " while sharing a frozenset");
+    Py_DECREF(items);
+    if (shared == NULL) {
+        return -1;
+    }
+    _PyXIData_Init(xidata, tstate->interp, shared, obj, _new_frozenset_object);
+    _PyXIData_SET_FREE(xidata, _tuple_shared_free);
+    return 0;
+}
+
+// frozendict
+
+/* The keys and values are shared as a flat sequence of pairs. */
+
+static PyObject *
+_new_frozendict_object(_PyXIData_t *xidata)
+{
+    PyObject *items = _new_tuple_object(xidata);
+    if (items == NULL) {
+        return NULL;
+    }
+    PyObject *dict = PyDict_New();
+    if (dict == NULL) {
+        Py_DECREF(items);
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(items); i += 2) {
+        if (PyDict_SetItem(dict, PyTuple_GET_ITEM(items, i),
+                           PyTuple_GET_ITEM(items, i + 1)) < 0)
+        {
+            Py_DECREF(dict);
+            Py_DECREF(items);
+            return NULL;
+        }
+    }
+    Py_DECREF(items);
+    PyObject *frozendict = PyFrozenDict_New(dict);
+    Py_DECREF(dict);
+    return frozendict;
+}
+
+static int
+_frozendict_shared(PyThreadState *tstate, PyObject *obj,
+                   xidata_fallback_t fallback, _PyXIData_t *xidata)
+{
+    PyObject *items = PyTuple_New(2 * PyDict_GET_SIZE(obj));
+    if (items == NULL) {
+        return -1;
+    }
+    /* A frozendict cannot change size while it is iterated. */
+    PyObject *key, *value;
+    Py_ssize_t pos = 0, i = 0;
+    while (PyDict_Next(obj, &pos, &key, &value)) {
+        PyTuple_SET_ITEM(items, i++, Py_NewRef(key));
+        PyTuple_SET_ITEM(items, i++, Py_NewRef(value));
+    }
+    assert(i == PyTuple_GET_SIZE(items));
+    struct _shared_tuple_data *shared = _shared_items_new(
+        tstate, _PyTuple_ITEMS(items), PyTuple_GET_SIZE(items), fallback,
+        " while sharing a frozendict");
+    Py_DECREF(items);
+    if (shared == NULL) {
+        return -1;
+    }
+    _PyXIData_Init(xidata, tstate->interp, shared, obj, _new_frozendict_object);
+    _PyXIData_SET_FREE(xidata, _tuple_shared_free);
+    return 0;
 }
 
 // code
@@ -829,6 +932,16 @@ _register_builtins_for_crossinterpreter_data(dlregistry_t *xidregistry)
         Py_FatalError("could not register tuple for cross-interpreter sharing");
     }
 
+    // frozenset
+    if (REGISTER_FALLBACK(&PyFrozenSet_Type, _frozenset_shared) != 0) {
+        Py_FatalError("could not register frozenset for cross-interpreter sharing");
+    }
+
+    // frozendict
+    if (REGISTER_FALLBACK(&PyFrozenDict_Type, _frozendict_shared) != 0) {
+        Py_FatalError("could not register frozendict for cross-interpreter sharing");
+    }
+
     // For now, we do not register PyCode_Type or PyFunction_Type.
 #undef REGISTER
 #undef REGISTER_FALLBACK
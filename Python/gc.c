@@ -1368,6 +1368,7 @@ static void
 add_stats(GCState *gcstate, int gen, struct gc_collection_stats *stats)
 {
     gcstate->generation_stats[gen].duration += stats->duration;
+    gcstate->generation_stats[gen].mark_duration += stats->mark_duration;
     gcstate->generation_stats[gen].collected += stats->collected;
     gcstate->generation_stats[gen].uncollectable += stats->uncollectable;
     gcstate->generation_stats[gen].candidates += stats->candidates;
@@ -1505,8 +1506,20 @@ move_to_reachable(PyObject *op, PyGC_Head *reachable, int visited_space)
     return 0;
 }
 
+/* Return the maximum number of objects that a single incremental step may
+ * mark or examine, or 0 if there is no limit.  This is set by
+ * gc.set_increment_limit() and bounds the length of the pause of each
+ * increment, at the cost of doing less precise marking.
+ */
+static inline intptr_t
+increment_limit(GCState *gcstate)
+{
+    return gcstate->increment_limit;
+}
+
 static intptr_t
-mark_all_reachable(PyGC_Head *reachable, PyGC_Head *visited, int visited_space)
+mark_all_reachable(PyGC_Head *reachable, PyGC_Head *visited, int visited_space,
+                   intptr_t limit)
 {
     // Transitively traverse all objects from reachable, until empty
     struct container_and_flag arg = {
@@ -1514,7 +1527,18 @@ mark_all_reachable(PyGC_Head *reachable, PyGC_Head *visited, int visited_space)
         .visited_space = visited_space,
         .size = 0
     };
+    intptr_t traversed = 0;
     while (!gc_list_is_empty(reachable)) {
+        if (limit > 0 && traversed >= limit) {
+            /* The objects left in reachable are already marked as visited.
+             * Move them to visited without traversing them.  Objects only
+             * reachable from them stay in the pending space, where they will
+             * be examined by a later increment. This is safe: marking only
+             * proves that objects are alive, never that they are garbage. */
+            gc_list_merge(reachable, visited);
+            break;
+        }
+        traversed++;
         PyGC_Head *gc = _PyGCHead_NEXT(reachable);
         assert(gc_old_space(gc) == visited_space);
         gc_list_move(gc, visited);
@@ -1529,7 +1553,8 @@ mark_all_reachable(PyGC_Head *reachable, PyGC_Head *visited, int visited_space)
 }
 
 static intptr_t
-mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space, bool start)
+mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space,
+            bool start, intptr_t limit)
 {
     PyGC_Head reachable;
     gc_list_init(&reachable);
@@ -1582,13 +1607,14 @@ mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space, b
         ts = PyThreadState_Next(ts);
         HEAD_UNLOCK(runtime);
     }
-    objects_marked += mark_all_reachable(&reachable, visited, visited_space);
+    objects_marked += mark_all_reachable(&reachable, visited, visited_space, limit);
     assert(gc_list_is_empty(&reachable));
     return objects_marked;
 }
 
 static intptr_t
-mark_global_roots(PyInterpreterState *interp, PyGC_Head *visited, int visited_space)
+mark_global_roots(PyInterpreterState *interp, PyGC_Head *visited,
+                  int visited_space, intptr_t limit)
 {
     PyGC_Head reachable;
     gc_list_init(&reachable);
@@ -1605,7 +1631,7 @@ mark_global_roots(PyInterpreterState *interp, PyGC_Head *visited, int visited_sp
         objects_marked += move_to_reachable(types->for_extensions.initialized[i].tp_dict, &reachable, visited_space);
         objects_marked += move_to_reachable(types->for_extensions.initialized[i].tp_subclasses, &reachable, visited_space);
     }
-    objects_marked += mark_all_reachable(&reachable, visited, visited_space);
+    objects_marked += mark_all_reachable(&reachable, visited, visited_space, limit);
     assert(gc_list_is_empty(&reachable));
     return objects_marked;
 }
@@ -1616,8 +1642,14 @@ mark_at_start(PyThreadState *tstate)
     // TO DO -- Make this incremental
     GCState *gcstate = &tstate->interp->gc;
     PyGC_Head *visited = &gcstate->old[gcstate->visited_space].head;
-    Py_ssize_t objects_marked = mark_global_roots(tstate->interp, visited, gcstate->visited_space);
-    objects_marked += mark_stacks(tstate->interp, visited, gcstate->visited_space, true);
+    intptr_t limit = increment_limit(gcstate);
+    Py_ssize_t objects_marked = mark_global_roots(tstate->interp, visited,
+                                                  gcstate->visited_space, limit);
+    if (limit > 0) {
+        limit = Py_MAX(limit - objects_marked, 1);
+    }
+    objects_marked += mark_stacks(tstate->interp, visited,
+                                  gcstate->visited_space, true, limit);
     gcstate->work_to_do -= objects_marked;
     gcstate->phase = GC_PHASE_COLLECT;
     validate_spaces(gcstate);
@@ -1663,11 +1695,15 @@ gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
         return;
     }
     untrack_tuples(&gcstate->young.head);
+    PyTime_t mark_start, mark_stop;
+    (void)PyTime_PerfCounterRaw(&mark_start);
     if (gcstate->phase == GC_PHASE_MARK) {
         Py_ssize_t objects_marked = mark_at_start(tstate);
         GC_STAT_ADD(1, objects_transitively_reachable, objects_marked);
         gcstate->work_to_do -= objects_marked;
         stats->candidates += objects_marked;
+        (void)PyTime_PerfCounterRaw(&mark_stop);
+        stats->mark_duration += PyTime_AsSecondsDouble(mark_stop - mark_start);
         validate_spaces(gcstate);
         return;
     }
@@ -1679,14 +1715,22 @@ gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
     if (scale_factor < 2) {
         scale_factor = 2;
     }
-    intptr_t objects_marked = mark_stacks(tstate->interp, visited, gcstate->visited_space, false);
+    intptr_t limit = increment_limit(gcstate);
+    intptr_t objects_marked = mark_stacks(tstate->interp, visited,
+                                          gcstate->visited_space, false, limit);
+    (void)PyTime_PerfCounterRaw(&mark_stop);
+    stats->mark_duration += PyTime_AsSecondsDouble(mark_stop - mark_start);
     GC_STAT_ADD(1, objects_transitively_reachable, objects_marked);
     gcstate->work_to_do -= objects_marked;
     gc_list_set_space(&gcstate->young.head, gcstate->visited_space);
     gc_list_merge(&gcstate->young.head, &increment);
     gc_list_validate_space(&increment, gcstate->visited_space);
     Py_ssize_t increment_size = gc_list_size(&increment);
+    Py_ssize_t young_size = increment_size;
     while (increment_size < gcstate->work_to_do) {
+        if (limit > 0 && increment_size - young_size >= limit) {
+            break;
+        }
         if (gc_list_is_empty(not_visited)) {
             break;
         }
@@ -1760,7 +1804,11 @@ gc_collect_region(PyThreadState *tstate,
     assert(!_PyErr_Occurred(tstate));
 
     gc_list_init(&unreachable);
+    PyTime_t mark_start, mark_stop;
+    (void)PyTime_PerfCounterRaw(&mark_start);
     stats->candidates = deduce_unreachable(from, &unreachable);
+    (void)PyTime_PerfCounterRaw(&mark_stop);
+    stats->mark_duration += PyTime_AsSecondsDouble(mark_stop - mark_start);
     validate_consistent_old_space(from);
     untrack_tuples(from);
 
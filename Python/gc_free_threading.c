@@ -102,6 +102,9 @@ struct collection_state {
     Py_ssize_t uncollectable;
     Py_ssize_t candidates;
     Py_ssize_t long_lived_total;
+    // Time spent in the mark phase and with the world stopped, in seconds
+    double mark_duration;
+    double pause_duration;
     struct worklist unreachable;
     struct worklist legacy_finalizers;
     struct worklist wrcb_to_call;
@@ -2259,10 +2262,29 @@ record_deallocation(PyThreadState *tstate)
     }
 }
 
+// Stop the world and record the time at which the pause started.
+static void
+gc_stop_the_world(struct collection_state *state, PyTime_t *pause_start)
+{
+    (void)PyTime_PerfCounterRaw(pause_start);
+    _PyEval_StopTheWorld(state->interp);
+}
+
+// Restart the world and add the length of the pause to the stats.
+static void
+gc_start_the_world(struct collection_state *state, PyTime_t pause_start)
+{
+    _PyEval_StartTheWorld(state->interp);
+    PyTime_t pause_stop;
+    (void)PyTime_PerfCounterRaw(&pause_stop);
+    state->pause_duration += PyTime_AsSecondsDouble(pause_stop - pause_start);
+}
+
 static void
 gc_collect_internal(PyInterpreterState *interp, struct collection_state *state, int generation)
 {
-    _PyEval_StopTheWorld(interp);
+    PyTime_t pause_start, mark_start, mark_stop;
+    gc_stop_the_world(state, &pause_start);
 
     // update collection and allocation counters
     if (generation+1 < NUM_GENERATIONS) {
@@ -2295,6 +2317,8 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
 
     process_delayed_frees(interp, state);
 
+    (void)PyTime_PerfCounterRaw(&mark_start);
+
     #ifdef GC_ENABLE_MARK_ALIVE
     // If gc.freeze() was used, it seems likely that doing this "mark alive"
     // pass will not be a performance win.  Typically the majority of alive
@@ -2307,7 +2331,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
         // be ignored for rest of the GC pass.
         int err = gc_mark_alive_from_roots(interp, state);
         if (err < 0) {
-            _PyEval_StartTheWorld(interp);
+            gc_start_the_world(state, pause_start);
             PyErr_NoMemory();
             return;
         }
@@ -2317,11 +2341,14 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
     // Find unreachable objects
     int err = deduce_unreachable_heap(interp, state);
     if (err < 0) {
-        _PyEval_StartTheWorld(interp);
+        gc_start_the_world(state, pause_start);
         PyErr_NoMemory();
         return;
     }
 
+    (void)PyTime_PerfCounterRaw(&mark_stop);
+    state->mark_duration = PyTime_AsSecondsDouble(mark_stop - mark_start);
+
 #ifdef GC_DEBUG
     // At this point, no object should have the alive bit set
     gc_visit_heaps(interp, &validate_alive_bits, &state->base);
@@ -2337,7 +2364,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
 
     // Find weakref callbacks we will honor (but do not call them).
     find_weakref_callbacks(state);
-    _PyEval_StartTheWorld(interp);
+    gc_start_the_world(state, pause_start);
 
     // Deallocate any object from the refcount merge step
     cleanup_worklist(&state->objs_to_decref);
@@ -2347,7 +2374,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
     call_weakref_callbacks(state);
     finalize_garbage(state);
 
-    _PyEval_StopTheWorld(interp);
+    gc_stop_the_world(state, &pause_start);
     // Handle any objects that may have resurrected after the finalization.
     err = handle_resurrected_objects(state);
     // Clear free lists in all threads
@@ -2357,7 +2384,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
     }
     // Record the number of live GC objects
     interp->gc.long_lived_total = state->long_lived_total;
-    _PyEval_StartTheWorld(interp);
+    gc_start_the_world(state, pause_start);
 
 
     if (err < 0) {
@@ -2476,6 +2503,8 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
     stats->collected += m;
     stats->uncollectable += n;
     stats->duration += duration;
+    stats->mark_duration += state.mark_duration;
+    stats->pause_duration += state.pause_duration;
     stats->candidates += state.candidates;
 
     GC_STAT_ADD(generation, objects_collected, m);
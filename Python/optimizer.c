@@ -1445,6 +1445,101 @@ int effective_trace_length(_PyUOpInstruction *buffer, int length)
 #endif
 
 
+/* Cost of moving from one cached depth to another: one extra uop,
+ * plus one memory access per value spilled or reloaded. */
+static inline int
+spill_cost(int from, int to)
+{
+    if (from == to) {
+        return 0;
+    }
+    return 1 + (from > to ? from - to : to - from);
+}
+
+static_assert(MAX_CACHED_REGISTER <= 3,
+              "choose_cache_depths() stores each depth in two bits");
+
+/* Choose the input depth of every uop so that the total cost of the
+ * _SPILL_OR_RELOAD uops that have to be inserted between them is minimal.
+ * This is a shortest path over (uop, input depth) pairs. The predecessor
+ * of each state is packed, two bits per depth, into from[i], which is then
+ * overwritten with the chosen input depth when walking back along the path. */
+static void
+choose_cache_depths(_PyUOpInstruction *buffer, int length, uint8_t *from)
+{
+    int cost[MAX_CACHED_REGISTER + 1];
+    int out[MAX_CACHED_REGISTER + 1];
+    int last = -1;
+    for (int d = 0; d <= MAX_CACHED_REGISTER; d++) {
+        cost[d] = INT_MAX;
+        out[d] = -1;
+    }
+    // The executor starts with nothing cached.
+    cost[0] = 0;
+    out[0] = 0;
+    for (int i = 0; i < length; i++) {
+        int uop = buffer[i].opcode;
+        if (uop == _NOP) {
+            continue;
+        }
+        const _PyUopCachingInfo *info = &_PyUop_Caching[uop];
+        const _PyUopTOSentry *entries = info->entries;
+        /* Only values known to be on the stack may be reloaded: those
+         * popped by this uop, or what the generator picked as best. */
+        int popped = _PyUop_num_popped(uop, buffer[i].oparg);
+        int new_cost[MAX_CACHED_REGISTER + 1];
+        uint8_t links = 0;
+        for (int d = 0; d <= MAX_CACHED_REGISTER; d++) {
+            new_cost[d] = INT_MAX;
+            if (entries[d].opcode <= 0) {
+                continue;
+            }
+            int best = -1;
+            for (int e = 0; e <= MAX_CACHED_REGISTER; e++) {
+                if (cost[e] == INT_MAX) {
+                    continue;
+                }
+                if (d > out[e] && d > popped && d > info->best[out[e]]) {
+                    continue;
+                }
+                int c = cost[e] + spill_cost(out[e], d);
+                // On a tie, prefer the path that needs no spill here.
+                if (c < new_cost[d] || (c == new_cost[d] && out[e] == d)) {
+                    new_cost[d] = c;
+                    best = e;
+                }
+            }
+            if (best >= 0) {
+                links |= (uint8_t)(best << (2 * d));
+            }
+        }
+        for (int d = 0; d <= MAX_CACHED_REGISTER; d++) {
+            cost[d] = new_cost[d];
+            out[d] = cost[d] == INT_MAX ? -1 : entries[d].output;
+        }
+        from[i] = links;
+        last = i;
+    }
+    if (last < 0) {
+        return;
+    }
+    int depth = 0;
+    for (int d = 1; d <= MAX_CACHED_REGISTER; d++) {
+        if (cost[d] < cost[depth]) {
+            depth = d;
+        }
+    }
+    assert(cost[depth] != INT_MAX);
+    for (int i = last; i >= 0; i--) {
+        if (buffer[i].opcode == _NOP) {
+            continue;
+        }
+        int prev = (from[i] >> (2 * depth)) & 3;
+        from[i] = (uint8_t)depth;
+        depth = prev;
+    }
+}
+
 static int
 stack_allocate(_PyUOpInstruction *buffer, _PyUOpInstruction *output, int length)
 {
@@ -1462,6 +1557,8 @@ stack_allocate(_PyUOpInstruction *buffer, _PyUOpInstruction *output, int length)
     else {
         assert(output + UOP_MAX_TRACE_LENGTH == buffer);
     }
+    uint8_t input_depth[UOP_MAX_TRACE_LENGTH];
+    choose_cache_depths(buffer, length, input_depth);
     int depth = 0;
     _PyUOpInstruction *write = output;
     for (int i = 0; i < length; i++) {
@@ -1469,7 +1566,7 @@ stack_allocate(_PyUOpInstruction *buffer, _PyUOpInstruction *output, int length)
         if (uop == _NOP) {
             continue;
         }
-        int new_depth = _PyUop_Caching[uop].best[depth];
+        int new_depth = input_depth[i];
         if (new_depth != depth) {
             write->opcode = _PyUop_SpillsAndReloads[depth][new_depth];
             assert(write->opcode != 0);
@@ -346,6 +346,22 @@ optimize_to_bool(
     return 0;
 }
 
+/* Upper bound on the data stack space requested by a merged
+ * _CHECK_STACK_SPACE_OPERAND, so that it doesn't fail much more often
+ * than the separate checks would. */
+#define MAX_MERGED_STACK_SPACE \
+    ((int)(_PY_DATA_STACK_CHUNK_SIZE / sizeof(PyObject *) / 4))
+
+/* A frame was pushed or popped in a way that isn't accounted for by
+ * the pending stack space and recursion checks, so later calls need
+ * their own. */
+static void
+reset_call_checks(JitOptContext *ctx)
+{
+    ctx->stack_space_check = NULL;
+    ctx->recursion_check = NULL;
+}
+
 static void
 eliminate_pop_guard(_PyUOpInstruction *this_instr, JitOptContext *ctx, bool exit)
 {
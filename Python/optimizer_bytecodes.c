@@ -299,18 +299,27 @@ dummy_func(void) {
     }
 
     op(_BINARY_OP_ADD_FLOAT, (left, right -- res, l, r)) {
+        if (!PyJitRef_IsBorrowed(left) || !PyJitRef_IsBorrowed(right)) {
+            ADD_OP(_BINARY_OP_ADD_FLOAT_INPLACE, 0, 0);
+        }
         res = sym_new_type(ctx, &PyFloat_Type);
         l = left;
         r = right;
     }
 
     op(_BINARY_OP_SUBTRACT_FLOAT, (left, right -- res, l, r)) {
+        if (!PyJitRef_IsBorrowed(left) || !PyJitRef_IsBorrowed(right)) {
+            ADD_OP(_BINARY_OP_SUBTRACT_FLOAT_INPLACE, 0, 0);
+        }
         res = sym_new_type(ctx, &PyFloat_Type);
         l = left;
         r = right;
     }
 
     op(_BINARY_OP_MULTIPLY_FLOAT, (left, right -- res, l, r)) {
+        if (!PyJitRef_IsBorrowed(left) || !PyJitRef_IsBorrowed(right)) {
+            ADD_OP(_BINARY_OP_MULTIPLY_FLOAT_INPLACE, 0, 0);
+        }
         res = sym_new_type(ctx, &PyFloat_Type);
         l = left;
         r = right;
@@ -362,6 +371,7 @@ dummy_func(void) {
     }
 
     op(_BINARY_OP_SUBSCR_INIT_CALL, (container, sub, getitem -- new_frame)) {
+        reset_call_checks(ctx);
         _Py_UOpsAbstractFrame *f = frame_new_from_symbol(ctx, getitem, 0, NULL, 0);
         if (f == NULL) {
             break;
@@ -833,6 +843,7 @@ dummy_func(void) {
         // + 1 for _SAVE_RETURN_OFFSET
         // FIX ME -- This needs a version check and function watcher
         PyCodeObject *co = (PyCodeObject *)((PyFunctionObject *)fget)->func_code;
+        reset_call_checks(ctx);
         _Py_UOpsAbstractFrame *f = frame_new(ctx, co, 0, NULL, 0);
         if (f == NULL) {
             break;
@@ -907,14 +918,17 @@ dummy_func(void) {
     }
 
     op(_PY_FRAME_GENERAL, (callable, self_or_null, args[oparg] -- new_frame)) {
+        reset_call_checks(ctx);
         new_frame = PyJitRef_WrapInvalid(frame_new_from_symbol(ctx, callable, 0, NULL, 0));
     }
 
     op(_PY_FRAME_KW, (callable, self_or_null, args[oparg], kwnames -- new_frame)) {
+        reset_call_checks(ctx);
         new_frame = PyJitRef_WrapInvalid(frame_new_from_symbol(ctx, callable, 0, NULL, 0));
     }
 
     op(_PY_FRAME_EX, (func_st, null, callargs_st, kwargs_st -- ex_frame)) {
+        reset_call_checks(ctx);
         ex_frame = PyJitRef_WrapInvalid(frame_new_from_symbol(ctx, func_st, 0, NULL, 0));
     }
 
@@ -926,6 +940,7 @@ dummy_func(void) {
     }
 
     op(_CREATE_INIT_FRAME, (init, self, args[oparg] -- init_frame)) {
+        reset_call_checks(ctx);
         ctx->frame->stack_pointer = stack_pointer - oparg - 2;
         _Py_UOpsAbstractFrame *shim = frame_new(ctx, (PyCodeObject *)&_Py_InitCleanup, 0, NULL, 0);
         if (shim == NULL) {
@@ -962,6 +977,13 @@ dummy_func(void) {
                 REPLACE_OP((this_instr + 2), _NOP, 0, 0);
             }
         }
+        if (ctx->stack_space_check != NULL && ctx->pushed_frames > 0) {
+            ctx->pushed_space -= ctx->frame->code->co_framesize;
+            ctx->pushed_frames--;
+        }
+        else {
+            reset_call_checks(ctx);
+        }
         if (frame_pop(ctx, returning_code, returning_stacklevel)) {
             break;
         }
@@ -972,6 +994,7 @@ dummy_func(void) {
     }
 
     op(_RETURN_GENERATOR, ( -- res)) {
+        reset_call_checks(ctx);
         SYNC_SP();
         ctx->frame->stack_pointer = stack_pointer;
         assert(this_instr[1].opcode == _RECORD_CODE);
@@ -991,6 +1014,7 @@ dummy_func(void) {
     }
 
     op(_YIELD_VALUE, (retval -- value)) {
+        reset_call_checks(ctx);
         // Mimics PyStackRef_MakeHeapSafe in the interpreter.
         JitOptRef temp = PyJitRef_StripReferenceInfo(retval);
         DEAD(retval);
@@ -1025,6 +1049,7 @@ dummy_func(void) {
     }
 
     op(_FOR_ITER_GEN_FRAME, (iter, unused -- iter, unused, gen_frame)) {
+        reset_call_checks(ctx);
         _Py_UOpsAbstractFrame *new_frame = frame_new_from_symbol(ctx, iter, 1, NULL, 0);
         if (new_frame == NULL) {
             ctx->done = true;
@@ -1035,6 +1060,7 @@ dummy_func(void) {
     }
 
     op(_SEND_GEN_FRAME, (receiver, v -- receiver, gen_frame)) {
+        reset_call_checks(ctx);
         _Py_UOpsAbstractFrame *new_frame = frame_new_from_symbol(ctx, receiver, 1, NULL, 0);
         if (new_frame == NULL) {
             ctx->done = true;
@@ -1050,13 +1076,49 @@ dummy_func(void) {
             ctx->done = true;
             break;
         }
+        // Fold the check into the one of an earlier call in the trace,
+        // widened to cover the frames that are live at this point.
+        _PyUOpInstruction *check = ctx->stack_space_check;
+        int needed = ctx->pushed_space + co->co_framesize;
+        if (check != NULL && needed <= MAX_MERGED_STACK_SPACE) {
+            if (check->operand0 < (uint64_t)needed) {
+                check->operand0 = needed;
+            }
+            ADD_OP(_NOP, 0, 0);
+            break;
+        }
         ADD_OP(_CHECK_STACK_SPACE_OPERAND, 0, co->co_framesize);
+        ctx->stack_space_check = uop_buffer_last(&ctx->out_buffer);
+        ctx->recursion_check = NULL;
+        ctx->pushed_space = 0;
+        ctx->pushed_frames = 0;
     }
 
     op (_CHECK_STACK_SPACE_OPERAND, (framesize/2 -- )) {
         (void)framesize;
     }
 
+    op(_CHECK_RECURSION_REMAINING, (--)) {
+        // Only merge checks made while the stack space check is active;
+        // the depth is counted from the point the stack space check ran.
+        int depth = ctx->pushed_frames + 1;
+        _PyUOpInstruction *check = ctx->recursion_check;
+        if (check != NULL) {
+            if (check->operand0 < (uint64_t)depth) {
+                check->operand0 = depth;
+            }
+            ADD_OP(_NOP, 0, 0);
+        }
+        else if (ctx->stack_space_check != NULL && ctx->pushed_frames == 0) {
+            ADD_OP(_CHECK_RECURSION_REMAINING_OPERAND, 0, depth);
+            ctx->recursion_check = uop_buffer_last(&ctx->out_buffer);
+        }
+    }
+
+    op(_CHECK_RECURSION_REMAINING_OPERAND, (depth/2 --)) {
+        (void)depth;
+    }
+
     op(_PUSH_FRAME, (new_frame -- )) {
         SYNC_SP();
         if (!CURRENT_FRAME_IS_INIT_SHIM()) {
@@ -1065,6 +1127,10 @@ dummy_func(void) {
         ctx->frame = (_Py_UOpsAbstractFrame *)PyJitRef_Unwrap(new_frame);
         ctx->curr_frame_depth++;
         stack_pointer = ctx->frame->stack_pointer;
+        if (ctx->stack_space_check != NULL) {
+            ctx->pushed_space += ctx->frame->code->co_framesize;
+            ctx->pushed_frames++;
+        }
         // Fixed calls don't need IP guards.
         if ((this_instr-1)->opcode == _CREATE_INIT_FRAME) {
             assert((this_instr+1)->opcode == _GUARD_IP__PUSH_FRAME);
@@ -782,6 +782,9 @@
             JitOptRef r;
             right = stack_pointer[-1];
             left = stack_pointer[-2];
+            if (!PyJitRef_IsBorrowed(left) || !PyJitRef_IsBorrowed(right)) {
+                ADD_OP(_BINARY_OP_MULTIPLY_FLOAT_INPLACE, 0, 0);
+            }
             res = sym_new_type(ctx, &PyFloat_Type);
             l = left;
             r = right;
@@ -802,6 +805,9 @@
             JitOptRef r;
             right = stack_pointer[-1];
             left = stack_pointer[-2];
+            if (!PyJitRef_IsBorrowed(left) || !PyJitRef_IsBorrowed(right)) {
+                ADD_OP(_BINARY_OP_ADD_FLOAT_INPLACE, 0, 0);
+            }
             res = sym_new_type(ctx, &PyFloat_Type);
             l = left;
             r = right;
@@ -822,6 +828,9 @@
             JitOptRef r;
             right = stack_pointer[-1];
             left = stack_pointer[-2];
+            if (!PyJitRef_IsBorrowed(left) || !PyJitRef_IsBorrowed(right)) {
+                ADD_OP(_BINARY_OP_SUBTRACT_FLOAT_INPLACE, 0, 0);
+            }
             res = sym_new_type(ctx, &PyFloat_Type);
             l = left;
             r = right;
@@ -834,6 +843,54 @@
             break;
         }
 
+        case _BINARY_OP_MULTIPLY_FLOAT_INPLACE: {
+            JitOptRef res;
+            JitOptRef l;
+            JitOptRef r;
+            res = sym_new_not_null(ctx);
+            l = sym_new_not_null(ctx);
+            r = sym_new_not_null(ctx);
+            CHECK_STACK_BOUNDS(1);
+            stack_pointer[-2] = res;
+            stack_pointer[-1] = l;
+            stack_pointer[0] = r;
+            stack_pointer += 1;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
+        case _BINARY_OP_ADD_FLOAT_INPLACE: {
+            JitOptRef res;
+            JitOptRef l;
+            JitOptRef r;
+            res = sym_new_not_null(ctx);
+            l = sym_new_not_null(ctx);
+            r = sym_new_not_null(ctx);
+            CHECK_STACK_BOUNDS(1);
+            stack_pointer[-2] = res;
+            stack_pointer[-1] = l;
+            stack_pointer[0] = r;
+            stack_pointer += 1;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_FLOAT_INPLACE: {
+            JitOptRef res;
+            JitOptRef l;
+            JitOptRef r;
+            res = sym_new_not_null(ctx);
+            l = sym_new_not_null(ctx);
+            r = sym_new_not_null(ctx);
+            CHECK_STACK_BOUNDS(1);
+            stack_pointer[-2] = res;
+            stack_pointer[-1] = l;
+            stack_pointer[0] = r;
+            stack_pointer += 1;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
         case _BINARY_OP_ADD_UNICODE: {
             JitOptRef right;
             JitOptRef left;
@@ -1162,6 +1219,7 @@
             getitem = stack_pointer[-1];
             sub = stack_pointer[-2];
             container = stack_pointer[-3];
+            reset_call_checks(ctx);
             _Py_UOpsAbstractFrame *f = frame_new_from_symbol(ctx, getitem, 0, NULL, 0);
             if (f == NULL) {
                 break;
@@ -1280,6 +1338,13 @@
                     REPLACE_OP((this_instr + 2), _NOP, 0, 0);
                 }
             }
+            if (ctx->stack_space_check != NULL && ctx->pushed_frames > 0) {
+                ctx->pushed_space -= ctx->frame->code->co_framesize;
+                ctx->pushed_frames--;
+            }
+            else {
+                reset_call_checks(ctx);
+            }
             if (frame_pop(ctx, returning_code, returning_stacklevel)) {
                 break;
             }
@@ -1324,6 +1389,7 @@
             JitOptRef gen_frame;
             v = stack_pointer[-1];
             receiver = stack_pointer[-2];
+            reset_call_checks(ctx);
             _Py_UOpsAbstractFrame *new_frame = frame_new_from_symbol(ctx, receiver, 1, NULL, 0);
             if (new_frame == NULL) {
                 ctx->done = true;
@@ -1339,6 +1405,7 @@
             JitOptRef retval;
             JitOptRef value;
             retval = stack_pointer[-1];
+            reset_call_checks(ctx);
             JitOptRef temp = PyJitRef_StripReferenceInfo(retval);
             CHECK_STACK_BOUNDS(-1);
             stack_pointer += -1;
@@ -2011,6 +2078,7 @@
             owner = stack_pointer[-1];
             PyObject *fget = (PyObject *)this_instr->operand0;
             PyCodeObject *co = (PyCodeObject *)((PyFunctionObject *)fget)->func_code;
+            reset_call_checks(ctx);
             _Py_UOpsAbstractFrame *f = frame_new(ctx, co, 0, NULL, 0);
             if (f == NULL) {
                 break;
@@ -2711,6 +2779,7 @@
             JitOptRef iter;
             JitOptRef gen_frame;
             iter = stack_pointer[-2];
+            reset_call_checks(ctx);
             _Py_UOpsAbstractFrame *new_frame = frame_new_from_symbol(ctx, iter, 1, NULL, 0);
             if (new_frame == NULL) {
                 ctx->done = true;
@@ -2897,6 +2966,7 @@
             JitOptRef callable;
             JitOptRef new_frame;
             callable = stack_pointer[-2 - oparg];
+            reset_call_checks(ctx);
             new_frame = PyJitRef_WrapInvalid(frame_new_from_symbol(ctx, callable, 0, NULL, 0));
             CHECK_STACK_BOUNDS(-1 - oparg);
             stack_pointer[-2 - oparg] = new_frame;
@@ -3009,11 +3079,36 @@
                 ctx->done = true;
                 break;
             }
+            _PyUOpInstruction *check = ctx->stack_space_check;
+            int needed = ctx->pushed_space + co->co_framesize;
+            if (check != NULL && needed <= MAX_MERGED_STACK_SPACE) {
+                if (check->operand0 < (uint64_t)needed) {
+                    check->operand0 = needed;
+                }
+                ADD_OP(_NOP, 0, 0);
+                break;
+            }
             ADD_OP(_CHECK_STACK_SPACE_OPERAND, 0, co->co_framesize);
+            ctx->stack_space_check = uop_buffer_last(&ctx->out_buffer);
+            ctx->recursion_check = NULL;
+            ctx->pushed_space = 0;
+            ctx->pushed_frames = 0;
             break;
         }
 
         case _CHECK_RECURSION_REMAINING: {
+            int depth = ctx->pushed_frames + 1;
+            _PyUOpInstruction *check = ctx->recursion_check;
+            if (check != NULL) {
+                if (check->operand0 < (uint64_t)depth) {
+                    check->operand0 = depth;
+                }
+                ADD_OP(_NOP, 0, 0);
+            }
+            else if (ctx->stack_space_check != NULL && ctx->pushed_frames == 0) {
+                ADD_OP(_CHECK_RECURSION_REMAINING_OPERAND, 0, depth);
+                ctx->recursion_check = uop_buffer_last(&ctx->out_buffer);
+            }
             break;
         }
 
@@ -3056,6 +3151,10 @@
             ctx->frame = (_Py_UOpsAbstractFrame *)PyJitRef_Unwrap(new_frame);
             ctx->curr_frame_depth++;
             stack_pointer = ctx->frame->stack_pointer;
+            if (ctx->stack_space_check != NULL) {
+                ctx->pushed_space += ctx->frame->code->co_framesize;
+                ctx->pushed_frames++;
+            }
             if ((this_instr-1)->opcode == _CREATE_INIT_FRAME) {
                 assert((this_instr+1)->opcode == _GUARD_IP__PUSH_FRAME);
                 REPLACE_OP(this_instr+1, _NOP, 0, 0);
@@ -3212,6 +3311,7 @@
             args = &stack_pointer[-oparg];
             self = stack_pointer[-1 - oparg];
             init = stack_pointer[-2 - oparg];
+            reset_call_checks(ctx);
             ctx->frame->stack_pointer = stack_pointer - oparg - 2;
             _Py_UOpsAbstractFrame *shim = frame_new(ctx, (PyCodeObject *)&_Py_InitCleanup, 0, NULL, 0);
             if (shim == NULL) {
@@ -3500,6 +3600,7 @@
             JitOptRef callable;
             JitOptRef new_frame;
             callable = stack_pointer[-3 - oparg];
+            reset_call_checks(ctx);
             new_frame = PyJitRef_WrapInvalid(frame_new_from_symbol(ctx, callable, 0, NULL, 0));
             CHECK_STACK_BOUNDS(-2 - oparg);
             stack_pointer[-3 - oparg] = new_frame;
@@ -3548,6 +3649,7 @@
             JitOptRef func_st;
             JitOptRef ex_frame;
             func_st = stack_pointer[-4];
+            reset_call_checks(ctx);
             ex_frame = PyJitRef_WrapInvalid(frame_new_from_symbol(ctx, func_st, 0, NULL, 0));
             CHECK_STACK_BOUNDS(-3);
             stack_pointer[-4] = ex_frame;
@@ -3589,6 +3691,7 @@
 
         case _RETURN_GENERATOR: {
             JitOptRef res;
+            reset_call_checks(ctx);
             ctx->frame->stack_pointer = stack_pointer;
             assert(this_instr[1].opcode == _RECORD_CODE);
             PyCodeObject *returning_code = (PyCodeObject *)this_instr[1].operand0;
@@ -3899,6 +4002,12 @@
             break;
         }
 
+        case _CHECK_RECURSION_REMAINING_OPERAND: {
+            uint32_t depth = (uint32_t)this_instr->operand0;
+            (void)depth;
+            break;
+        }
+
         case _SAVE_RETURN_OFFSET: {
             break;
         }
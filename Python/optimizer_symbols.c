@@ -1406,6 +1406,9 @@ _Py_uop_abstractcontext_init(JitOptContext *ctx)
     ctx->out_of_space = false;
     ctx->contradiction = false;
     ctx->builtins_watched = false;
+
+    ctx->stack_space_check = NULL;
+    ctx->recursion_check = NULL;
 }
 
 int
@@ -693,6 +693,7 @@ def has_error_without_pop(op: parser.CodeDef) -> bool:
     "advance_backoff_counter",
     "assert",
     "backoff_counter_triggers",
+    "float_from_double_inplace",
     "initial_temperature_backoff_counter",
     "JUMP_TO_LABEL",
     "restart_backoff_counter",
@@ -28,7 +28,7 @@
 import sys
 import threading
 import time
-from collections import namedtuple
+from collections import ConcurrentDict, namedtuple
 from dataclasses import dataclass
 from operator import methodcaller
 from typing import NamedTuple
@@ -236,6 +236,26 @@ def instantiate_typing_namedtuple():
         obj = MyTypingNamedTuple(x=1, y=2, z=3)
 
 
+shared_concurrent_dict = ConcurrentDict()
+
+@register_benchmark
+def concurrent_dict():
+    d = shared_concurrent_dict
+    key = threading.get_ident()
+    for i in range(500 * WORK_SCALE):
+        d[key, i % 100] = i
+        d.get((key, i % 100))
+
+shared_simple_queue = queue.SimpleQueue()
+
+@register_benchmark
+def simple_queue():
+    q = shared_simple_queue
+    for i in range(500 * WORK_SCALE):
+        q.put(i)
+        q.get()
+        q.empty()
+
 @register_benchmark
 def deepcopy():
     x = {'list': [1, 2], 'tuple': (1, None)}